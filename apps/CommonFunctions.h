@@ -156,7 +156,7 @@ void initRandomObstacles(size_t num_obstacles, const Eigen::Vector3f &dim, scena
 		// env->addObject(object, vel, acc);
 
 		if (!env->isValid(pos, vel.norm()) || 
-			ss->computeDistance(scenario.getStart(), true) < 6 * DRGBTConfig::D_CRIT) // Just to ensure safety of init. conf.
+			ss->computeDistance(scenario.getStart()) < 6 * DRGBTConfig::D_CRIT) // Just to ensure safety of init. conf.
 		{
 			env->removeObject(i);
 			i--;
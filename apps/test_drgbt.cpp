@@ -157,7 +157,12 @@ int main(int argc, char **argv)
 				if (result)
 				{
 					std::vector<std::vector<float>> routine_times { planner->getPlannerInfo()->getRoutineTimes() };
-					for (size_t idx = 0; idx < routines.size(); idx++)
+					std::vector<float> routine_wcets { planner->getPlannerInfo()->getRoutineWCETs() };
+					output_file << "Iteration WCET [s]:\n" << planner->getPlannerInfo()->getIterationWCET() << std::endl;
+					for (size_t idx = 0; idx < routines.size() && idx < routine_wcets.size(); idx++)
+						output_file << "Routine " << routines[idx] << " WCET: " << routine_wcets[idx] << std::endl;
+					
+					for (size_t idx = 0; idx < routines.size() && idx < routine_times.size(); idx++)
 					{
 						// LOG(INFO) << "Routine " << routines[idx];
 						// LOG(INFO) << "\tAverage time: " << getMean(routine_times[idx]) << " +- " << getStd(routine_times[idx]);
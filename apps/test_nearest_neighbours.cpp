@@ -0,0 +1,83 @@
+//
+// Created by agent on 19.10.26.
+//
+
+#include <chrono>
+#include <random>
+#include <glog/logging.h>
+
+#include "Tree.h"
+#include "RealVectorSpaceState.h"
+
+// Benchmark of nearest-neighbour indexes: for each dimensionality and tree size, the time of building the tree (state by state)
+// and the average query time are measured. All results are compared with brute force.
+int main([[maybe_unused]] int argc, char **argv)
+{
+	google::InitGoogleLogging(argv[0]);
+	FLAGS_logtostderr = true;
+
+	const std::vector<size_t> dimensions { 2, 6, 10 };
+	const std::vector<size_t> tree_sizes { 100, 1000, 10000, 100000 };
+	const std::vector<base::NearestNeighboursType> types { base::NearestNeighboursType::BruteForce, base::NearestNeighboursType::KdTree, 
+		base::NearestNeighboursType::GNAT, base::NearestNeighboursType::Adaptive };		// Brute force is the first, since it is the reference
+	const size_t num_queries { 1000 };
+	std::mt19937 generator(0);
+	std::uniform_real_distribution<float> distribution(-M_PI, M_PI);
+	auto getElapsedTime = [](const std::chrono::steady_clock::time_point &time_start) -> float
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - time_start).count() * 1e-3;
+	};
+
+	for (size_t num_dimensions : dimensions)
+	{
+		for (size_t tree_size : tree_sizes)
+		{
+			std::vector<std::shared_ptr<base::State>> states {};
+			std::vector<std::shared_ptr<base::State>> queries {};
+			for (size_t i = 0; i < tree_size + num_queries; i++)
+			{
+				Eigen::VectorXf coord(num_dimensions);
+				for (size_t k = 0; k < num_dimensions; k++)
+					coord(k) = distribution(generator);
+
+				(i < tree_size ? states : queries).emplace_back(std::make_shared<base::RealVectorSpaceState>(coord));
+			}
+
+			LOG(INFO) << "Num. dimensions: " << num_dimensions << "\t Tree size: " << tree_size;
+			std::vector<size_t> nearest_idx {};
+			for (base::NearestNeighboursType type : types)
+			{
+				base::Tree tree("benchmark", 0);
+				tree.setNearestNeighbours(base::NearestNeighbours::create(type, tree, num_dimensions));
+
+				auto time_start { std::chrono::steady_clock::now() };
+				for (const std::shared_ptr<base::State> &q : states)
+					tree.upgradeTree(q, nullptr);
+				float build_time { getElapsedTime(time_start) };
+
+				size_t num_errors { 0 };
+				std::vector<size_t> idx(num_queries);
+				time_start = std::chrono::steady_clock::now();
+				for (size_t i = 0; i < num_queries; i++)
+					idx[i] = tree.getNearestState(queries[i])->getIdx();
+				float query_time { getElapsedTime(time_start) / num_queries };
+
+				if (type == base::NearestNeighboursType::BruteForce)
+					nearest_idx = idx;
+				
+				for (size_t i = 0; i < num_queries; i++)
+				{
+					if ((states[idx[i]]->getCoord() - queries[i]->getCoord()).norm() >
+						(states[nearest_idx[i]]->getCoord() - queries[i]->getCoord()).norm() + 1e-5)
+						num_errors++;
+				}
+
+				LOG(INFO) << "\t" << type << ":\t build time: " << build_time << " [us] \t query time: " << query_time << " [us]"
+						  << (num_errors > 0 ? "\t num. wrong results: " + std::to_string(num_errors) : "");
+			}
+		}
+	}
+
+	google::ShutDownCommandLineFlags();
+	return 0;
+}
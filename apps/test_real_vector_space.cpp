@@ -28,7 +28,7 @@ int main(int argc, char **argv)
 	try
 	{
 		float d_c {};
-		std::shared_ptr<std::vector<Eigen::MatrixXf>> nearest_points { nullptr };
+		std::shared_ptr<base::NearestPoints> nearest_points { nullptr };
 		size_t num { 0 };
 
 		while (num++ < 1)
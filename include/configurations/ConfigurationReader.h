@@ -42,6 +42,26 @@ public:
         else
             LOG(INFO) << "RealVectorSpaceConfig::EQUALITY_THRESHOLD is not defined! Using default value of " << RealVectorSpaceConfig::EQUALITY_THRESHOLD;
 
+        if (RealVectorSpaceConfigRoot["SAMPLER_TYPE"].IsDefined())
+            RealVectorSpaceConfig::SAMPLER_TYPE = base::sampler_type_map[RealVectorSpaceConfigRoot["SAMPLER_TYPE"].as<std::string>()];
+        else
+            LOG(INFO) << "RealVectorSpaceConfig::SAMPLER_TYPE is not defined! Using default value of " << RealVectorSpaceConfig::SAMPLER_TYPE;
+
+        if (RealVectorSpaceConfigRoot["GOAL_BIAS"].IsDefined())
+            RealVectorSpaceConfig::GOAL_BIAS = RealVectorSpaceConfigRoot["GOAL_BIAS"].as<float>();
+        else
+            LOG(INFO) << "RealVectorSpaceConfig::GOAL_BIAS is not defined! Using default value of " << RealVectorSpaceConfig::GOAL_BIAS;
+
+        if (RealVectorSpaceConfigRoot["SAMPLER_STD_DEV"].IsDefined())
+            RealVectorSpaceConfig::SAMPLER_STD_DEV = RealVectorSpaceConfigRoot["SAMPLER_STD_DEV"].as<float>();
+        else
+            LOG(INFO) << "RealVectorSpaceConfig::SAMPLER_STD_DEV is not defined! Using default value of " << RealVectorSpaceConfig::SAMPLER_STD_DEV;
+
+        if (RealVectorSpaceConfigRoot["NEAREST_NEIGHBOURS_TYPE"].IsDefined())
+            RealVectorSpaceConfig::NEAREST_NEIGHBOURS_TYPE = base::nearest_neighbours_type_map[RealVectorSpaceConfigRoot["NEAREST_NEIGHBOURS_TYPE"].as<std::string>()];
+        else
+            LOG(INFO) << "RealVectorSpaceConfig::NEAREST_NEIGHBOURS_TYPE is not defined! Using default value of " << RealVectorSpaceConfig::NEAREST_NEIGHBOURS_TYPE;
+
         // RRTConnectConfigRoot
         if (RRTConnectConfigRoot["MAX_NUM_ITER"].IsDefined())
             RRTConnectConfig::MAX_NUM_ITER = RRTConnectConfigRoot["MAX_NUM_ITER"].as<size_t>();
@@ -150,6 +170,16 @@ public:
             RGBMTStarConfig::TERMINATE_WHEN_PATH_IS_FOUND = RGBMTStarConfigRoot["TERMINATE_WHEN_PATH_IS_FOUND"].as<bool>();
         else
             LOG(INFO) << "RGBMTStarConfig::TERMINATE_WHEN_PATH_IS_FOUND is not defined! Using default value of " << RGBMTStarConfig::TERMINATE_WHEN_PATH_IS_FOUND;
+        
+        if (RGBMTStarConfigRoot["INFORMED_SAMPLING"].IsDefined())
+            RGBMTStarConfig::INFORMED_SAMPLING = RGBMTStarConfigRoot["INFORMED_SAMPLING"].as<bool>();
+        else
+            LOG(INFO) << "RGBMTStarConfig::INFORMED_SAMPLING is not defined! Using default value of " << RGBMTStarConfig::INFORMED_SAMPLING;
+        
+        if (RGBMTStarConfigRoot["NUM_THREADS"].IsDefined())
+            RGBMTStarConfig::NUM_THREADS = RGBMTStarConfigRoot["NUM_THREADS"].as<size_t>();
+        else
+            LOG(INFO) << "RGBMTStarConfig::NUM_THREADS is not defined! Using default value of " << RGBMTStarConfig::NUM_THREADS;
 
         // DRGBTConfigRoot
         if (DRGBTConfigRoot["MAX_NUM_ITER"].IsDefined())
@@ -212,6 +242,41 @@ public:
         else
             LOG(INFO) << "DRGBTConfig::TRAJECTORY_INTERPOLATION is not defined! Using default value of " << DRGBTConfig::TRAJECTORY_INTERPOLATION;
         
+        if (DRGBTConfigRoot["TRAJECTORY_WINDOW_SIZE"].IsDefined())
+            DRGBTConfig::TRAJECTORY_WINDOW_SIZE = DRGBTConfigRoot["TRAJECTORY_WINDOW_SIZE"].as<size_t>();
+        else
+            LOG(INFO) << "DRGBTConfig::TRAJECTORY_WINDOW_SIZE is not defined! Using default value of " << DRGBTConfig::TRAJECTORY_WINDOW_SIZE;
+        
+        if (DRGBTConfigRoot["LOW_LATENCY"].IsDefined())
+            DRGBTConfig::LOW_LATENCY = DRGBTConfigRoot["LOW_LATENCY"].as<bool>();
+        else
+            LOG(INFO) << "DRGBTConfig::LOW_LATENCY is not defined! Using default value of " << DRGBTConfig::LOW_LATENCY;
+        
+        if (DRGBTConfigRoot["CPU_AFFINITY"].IsDefined())
+            DRGBTConfig::CPU_AFFINITY = DRGBTConfigRoot["CPU_AFFINITY"].as<int>();
+        else
+            LOG(INFO) << "DRGBTConfig::CPU_AFFINITY is not defined! Using default value of " << DRGBTConfig::CPU_AFFINITY;
+        
+        if (DRGBTConfigRoot["THREAD_PRIORITY"].IsDefined())
+            DRGBTConfig::THREAD_PRIORITY = DRGBTConfigRoot["THREAD_PRIORITY"].as<int>();
+        else
+            LOG(INFO) << "DRGBTConfig::THREAD_PRIORITY is not defined! Using default value of " << DRGBTConfig::THREAD_PRIORITY;
+        
+        if (DRGBTConfigRoot["NUM_THREADS"].IsDefined())
+            DRGBTConfig::NUM_THREADS = DRGBTConfigRoot["NUM_THREADS"].as<size_t>();
+        else
+            LOG(INFO) << "DRGBTConfig::NUM_THREADS is not defined! Using default value of " << DRGBTConfig::NUM_THREADS;
+        
+        if (DRGBTConfigRoot["PATH_SIMPLIFICATION"].IsDefined())
+            DRGBTConfig::PATH_SIMPLIFICATION = DRGBTConfigRoot["PATH_SIMPLIFICATION"].as<bool>();
+        else
+            LOG(INFO) << "DRGBTConfig::PATH_SIMPLIFICATION is not defined! Using default value of " << DRGBTConfig::PATH_SIMPLIFICATION;
+        
+        if (DRGBTConfigRoot["OBSTACLES_RANDOM_SEED"].IsDefined())
+            DRGBTConfig::OBSTACLES_RANDOM_SEED = DRGBTConfigRoot["OBSTACLES_RANDOM_SEED"].as<int>();
+        else
+            LOG(INFO) << "DRGBTConfig::OBSTACLES_RANDOM_SEED is not defined! Using default value of " << DRGBTConfig::OBSTACLES_RANDOM_SEED;
+        
         LOG(INFO) << "Configuration parameters read successfully!";
         
     }
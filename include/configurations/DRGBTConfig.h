@@ -23,4 +23,11 @@ public:
     static float MAX_TIME_TASK1;                                            // Maximal time which Task 1 can take from the processor
     static float MAX_TIME_UPDATE_CURRENT_STATE;                             // Maximal time for the routine 'updateCurrentState'
     static planning::TrajectoryInterpolation TRAJECTORY_INTERPOLATION;      // Method for interpolation of trajectory: "None" or "Spline"
+    static size_t TRAJECTORY_WINDOW_SIZE;                                   // Number of predefined path states through which a spline passes (1 means the robot always stops at 'q_next')
+    static bool LOW_LATENCY;                                                // Whether to run in the low-latency mode, i.e., with locked memory, real-time priority, and only WCET statistics (it is not hard real-time, since states of the realized path and distance queries still allocate)
+    static int CPU_AFFINITY;                                                // CPU to which the control task is pinned in the low-latency mode (-1 means no pinning)
+    static int THREAD_PRIORITY;                                             // Real-time (SCHED_FIFO) priority of the control task in the low-latency mode (0 means default priority)
+    static size_t NUM_THREADS;                                              // Number of threads used for computing the horizon spines (including the main thread)
+    static bool PATH_SIMPLIFICATION;                                        // Whether to simplify (shortcut) each new predefined path before it is acquired
+    static int OBSTACLES_RANDOM_SEED;                                       // Seed for random changes of motion directions of dynamic obstacles (-1 means a random seed)
 };
\ No newline at end of file
@@ -11,4 +11,6 @@ public:
     static size_t MAX_NUM_STATES;               // Maximal number of considered states
     static float MAX_PLANNING_TIME;             // Maximal algorithm runtime in [s]
     static bool TERMINATE_WHEN_PATH_IS_FOUND;   // Whether to terminate when path is found (default: false)
+    static bool INFORMED_SAMPLING;              // Whether to sample only states that can improve the path, and prune the others, once a path is found
+    static size_t NUM_THREADS;                  // Number of threads used for optimizing connections (including the main thread). It is 1 if the state space is not reentrant
 };
\ No newline at end of file
@@ -2,6 +2,9 @@
 // Created by dinko on 17.02.22.
 //
 
+#include <SamplerType.h>
+#include <NearestNeighboursType.h>
+
 typedef unsigned long size_t;
 
 class RealVectorSpaceConfig
@@ -9,4 +12,8 @@ class RealVectorSpaceConfig
 public:
     static float EQUALITY_THRESHOLD;                    // Threshold to determine whether two states are equal
     static size_t NUM_INTERPOLATION_VALIDITY_CHECKS;    // Number of discrete collision checks of the edge with the length of RRTConnectConfig::EPS_STEP
+    static base::SamplerType SAMPLER_TYPE;              // Type of a sampler for generating random states, which is used by all planners
+    static float GOAL_BIAS;                             // Probability of sampling the goal state (for GoalBias sampler)
+    static float SAMPLER_STD_DEV;                       // Standard deviation of a Gaussian sample around a uniform sample (for Gaussian and Bridge samplers)
+    static base::NearestNeighboursType NEAREST_NEIGHBOURS_TYPE;   // Type of an index for nearest-neighbour queries in trees
 };
\ No newline at end of file
@@ -6,10 +6,22 @@
 #ifndef RPMPL_ENVIRONMENT_H
 #define RPMPL_ENVIRONMENT_H
 
+#include <random>
+
 #include "Box.h"
 
 namespace env
-{	
+{
+	// Precomputed data of a single obstacle, which is read by collision and distance queries
+	struct ObstacleDescriptor
+	{
+		fcl::NODE_TYPE type;									// Geometry type of the obstacle
+		Eigen::VectorXf bounds;									// Box: (x_min, y_min, z_min, x_max, y_max, z_max). Sphere: (x_c, y_c, z_c, r)
+		unsigned long ignored_links;							// Bitmask of robot's links that are not checked against the obstacle
+		float max_vel;											// Maximal velocity of the obstacle in [m/s]
+		float time_updated;										// Environment time in [s] when the descriptor is last updated
+	};
+
 	class Environment
 	{
 	public:
@@ -18,14 +30,21 @@ namespace env
 
 		inline void setBaseRadius(float base_radius_) { base_radius = base_radius_; }
 		inline void setRobotMaxVel(float robot_max_vel_) { robot_max_vel = robot_max_vel_; }
-		inline void setTableIncluded(bool table_included_) { table_included = table_included_; }
+		inline void setRandomSeed(unsigned int seed) { generator.seed(seed); }
+		void setTableIncluded(bool table_included_);
 
 		inline const std::vector<std::shared_ptr<env::Object>> &getObjects() const { return objects; }
 		inline std::shared_ptr<env::Object> getObject(size_t idx) const { return objects[idx]; }
 		inline std::shared_ptr<fcl::CollisionObjectf> getCollObject(size_t idx) const { return objects[idx]->getCollObject(); }
 		inline size_t getNumObjects() const { return objects.size(); }
+		inline size_t getNumDynamicObstacles() const { return dynamic_obstacles.size(); }
 		inline const fcl::Vector3f &getWSCenter() const { return WS_center; }
 		inline float getWSRadius() const { return WS_radius; }
+		inline const std::vector<env::ObstacleDescriptor> &getObstacleTable() const { return obstacle_table; }
+		inline const env::ObstacleDescriptor &getObstacleDescriptor(size_t idx) const { return obstacle_table[idx]; }
+		inline size_t getVersion() const { return version; }
+		inline size_t getTableVersion() const { return table_version; }
+		inline float getTime() const { return time; }
 
 		void addObject(const std::shared_ptr<env::Object> object, const fcl::Vector3f &velocity = fcl::Vector3f::Zero(), 
 			const fcl::Vector3f &acceleration = fcl::Vector3f::Zero());
@@ -35,14 +54,40 @@ namespace env
 		void removeAllObjects();
 		bool isValid(const Eigen::Vector3f &pos, float vel);
 		void updateEnvironment(float delta_time);
+		std::shared_ptr<Eigen::Matrix3Xf> predictPositions(float t);
+		void predictDisplacements(float t, Eigen::Matrix3Xf &displacements) const;
 
 	private:
+		void computeObstacleTable();
+		void computeObstacleDescriptor(size_t idx);
+		void initDynamicObstacles();
+		void synchronizeObjects();
+		void computeValidMotion(size_t k, float delta_time);
+		fcl::Vector3f predictDisplacement(size_t k, float t) const;
+		fcl::Vector3f getRandomDirection();
+
+		static constexpr size_t MAX_NUM_MOTION_ATTEMPTS { 100 };	// Maximal number of attempts to compute a valid motion of a dynamic obstacle
+
 		std::vector<std::shared_ptr<env::Object>> objects;		// All objects/parts of the environment
         fcl::Vector3f WS_center;								// Workspace center point in [m]
         float WS_radius; 										// Workspace radius in [m]
 		float base_radius;
 		float robot_max_vel;
-		bool table_included;
+		bool table_included { false };							// Whether the table is included, which is read from the configuration file
+		std::vector<env::ObstacleDescriptor> obstacle_table;	// Descriptors of all objects, where 'obstacle_table[j]' corresponds to 'objects[j]'
+		size_t version;											// Incremented whenever 'obstacle_table' is changed. Zero means no version.
+		size_t table_version;									// Version in which objects are last added or removed
+		float time;												// Environment time in [s], i.e., the sum of all 'delta_time' passed to 'updateEnvironment'
+
+		// Store of dynamic obstacles, where k-th column corresponds to the object 'objects[dynamic_obstacles[k]]'
+		std::vector<size_t> dynamic_obstacles;					// Indices of dynamic obstacles in 'objects'
+		Eigen::Matrix3Xf positions;								// Positions in [m]
+		Eigen::Matrix3Xf velocities;							// Velocities in [m/s]
+		Eigen::Matrix3Xf accelerations;							// Accelerations in [m/s²]
+		Eigen::Matrix3Xf positions_new;							// Auxiliary storage for new positions
+		Eigen::Matrix3Xf velocities_new;						// Auxiliary storage for new velocities
+		Eigen::RowVectorXf vel_intensities;						// Auxiliary storage for new velocity intensities
+		std::mt19937 generator;									// Random number generator for changing directions of motion
 	};
 }
 #endif //RPMPL_ENVIRONMENT_H
\ No newline at end of file
@@ -10,6 +10,7 @@
 #include <chrono>
 
 #include "StateSpace.h"
+#include "Sampler.h"
 #include "PlannerInfo.h"
 #include "PlanningTypes.h"
 
@@ -36,6 +37,7 @@ namespace planning
 	protected:
 		planning::PlannerType planner_type;
 		std::shared_ptr<base::StateSpace> ss;
+		std::shared_ptr<base::Sampler> sampler;						// Sampler for generating random states in the whole C-space
 		std::shared_ptr<PlannerInfo> planner_info;
 		std::shared_ptr<base::State> q_start;
 		std::shared_ptr<base::State> q_goal;
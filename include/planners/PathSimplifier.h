@@ -0,0 +1,51 @@
+//
+// Created by agent on 19.10.26.
+//
+#ifndef RPMPL_PATHSIMPLIFIER_H
+#define RPMPL_PATHSIMPLIFIER_H
+
+#include <vector>
+#include <map>
+#include <memory>
+#include <random>
+#include <chrono>
+#include <atomic>
+
+#include "StateSpace.h"
+#include "WorkerPool.h"
+
+namespace planning
+{
+	// Post-processing of a path returned by a planner, which consists of greedy vertex skipping and randomized shortcutting.
+	// An edge is surely valid if it is covered by the bubbles of its endpoints, so the validity check is performed only for its remaining part.
+	// Results of edge checks are memoized, and candidate edges are checked in parallel by the workers from 'worker_pool'
+	// (only if the state space is reentrant, otherwise by the calling thread).
+	class PathSimplifier
+	{
+	public:
+		PathSimplifier(const std::shared_ptr<base::StateSpace> ss_, const std::shared_ptr<planning::WorkerPool> worker_pool_);
+		~PathSimplifier() {}
+
+		std::vector<std::shared_ptr<base::State>> simplify(const std::vector<std::shared_ptr<base::State>> &path, float max_time);
+
+		static constexpr size_t MAX_NUM_ROUNDS { 100 };		// Maximal number of rounds of randomized shortcutting
+		static constexpr float MIN_COST_DECREASE { 1e-3 };	// Shortcut is applied only if it decreases the path cost at least for this value
+
+	private:
+		std::vector<std::shared_ptr<base::State>> skipVertices(const std::vector<std::shared_ptr<base::State>> &path, float max_time);
+		bool shortcut(std::vector<std::shared_ptr<base::State>> &path);
+		bool checkEdge(const std::shared_ptr<base::State> q1, const std::shared_ptr<base::State> q2);
+		void checkEdges(const std::vector<std::pair<std::shared_ptr<base::State>, std::shared_ptr<base::State>>> &edges,
+						std::vector<char> &valid);
+		float getElapsedTime() const;
+
+		std::shared_ptr<base::StateSpace> ss;
+		std::shared_ptr<planning::WorkerPool> worker_pool;
+		size_t num_workers;			// Number of workers which check edges in parallel
+		std::chrono::steady_clock::time_point time_start;
+		std::map<std::pair<std::shared_ptr<base::State>, std::shared_ptr<base::State>>, bool> checked_edges;	// Memoized results of edge checks (states are kept alive, so their addresses are not reused)
+		std::mt19937 generator;
+	};
+}
+
+#endif //RPMPL_PATHSIMPLIFIER_H
@@ -6,6 +6,7 @@
 #define RPMPL_PLANNERINFO_H
 
 #include <vector>
+#include <algorithm>
 
 class PlannerInfo
 {
@@ -14,6 +15,8 @@ protected:
 	std::vector<float> state_times;
 	std::vector<float> cost_convergence;			// Cost vs state convergence rate (cost-state curve)
 	std::vector<std::vector<float>> routine_times; 	// Running times for the specified routine
+	std::vector<float> routine_wcets;				// Worst-case execution time for the specified routine
+	float iteration_wcet = 0;						// Worst-case execution time of a single iteration
 	float planning_time;
 	size_t num_collision_queries;
 	size_t num_distance_queries;
@@ -30,6 +33,8 @@ public:
 	void addStateTimes(const std::vector<float> &state_times);
 	void addCostConvergence(const std::vector<float> &cost_convergence);
 	void addRoutineTime(float time, size_t idx);
+	void updateRoutineWCET(float time, size_t idx);
+	inline void updateIterationWCET(float time) { iteration_wcet = std::max(iteration_wcet, time); }
 	inline void setPlanningTime(float planning_time_) { planning_time = planning_time_; }
 	inline void setNumCollisionQueries(size_t num_collision_queries_) { num_collision_queries = num_collision_queries_; }
 	inline void setNumDistanceQueries(size_t num_distance_queries_) { num_distance_queries = num_distance_queries_; }
@@ -42,6 +47,8 @@ public:
 	inline const std::vector<float> &getStateTimes() const { return state_times; }
 	inline const std::vector<float> &getCostConvergence() const { return cost_convergence; }
 	inline const std::vector<std::vector<float>> &getRoutineTimes() const {return routine_times; }
+	inline const std::vector<float> &getRoutineWCETs() const { return routine_wcets; }
+	inline float getIterationWCET() const { return iteration_wcet; }
 	inline float getPlanningTime() const { return planning_time; }
 	inline size_t getNumCollisionQueries() const { return num_collision_queries; }
 	inline size_t getNumDistanceQueries() const { return num_distance_queries; }
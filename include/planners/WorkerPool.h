@@ -0,0 +1,56 @@
+//
+// Created by agent on 19.10.26.
+//
+#ifndef RPMPL_WORKERPOOL_H
+#define RPMPL_WORKERPOOL_H
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <algorithm>
+#include <pthread.h>
+
+namespace planning
+{
+	// Fixed pool of worker threads, which are created once and reused for every job.
+	// The calling thread participates as the worker with index 0.
+	class WorkerPool
+	{
+	public:
+		WorkerPool(size_t num_workers_);
+		~WorkerPool();
+
+		inline size_t getNumWorkers() const { return num_workers; }
+
+		bool setPriority(int priority);
+
+		// Execute 'job_(worker_idx)' on all workers, and block until all of them return.
+		// The job itself is responsible for distributing the work among workers.
+		// 'job_' is called through a plain function pointer, thus no allocation occurs.
+		template <typename Job>
+		void run(Job &job_)
+		{
+			job_ptr = &job_;
+			job_caller = [](void *job_ptr_, size_t worker_idx) { (*static_cast<Job*>(job_ptr_))(worker_idx); };
+			runJob();
+		}
+
+	private:
+		void runJob();
+		void work(size_t worker_idx);
+
+		size_t num_workers;								// Total number of workers (including the calling thread)
+		std::vector<std::thread> threads;
+		std::mutex mutex;
+		std::condition_variable cv_start;
+		std::condition_variable cv_done;
+		void *job_ptr;									// Job that is currently being executed
+		void (*job_caller)(void*, size_t);				// Function that calls the job for the given worker index
+		size_t job_id;									// Incremented each time a new job is started
+		size_t num_busy;								// Number of threads that are still executing the current job
+		bool stop;
+	};
+}
+
+#endif //RPMPL_WORKERPOOL_H
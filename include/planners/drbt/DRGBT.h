@@ -7,7 +7,22 @@
 #include "RGBTConnect.h"
 #include "RGBMTStar.h"
 #include "HorizonState.h"
+#include "HorizonStatePool.h"
 #include "Spline5.h"
+#include "CompositeSpline.h"
+#include "Spline4.h"
+#include "SplinePool.h"
+#include "WorkerPool.h"
+#include "PathSimplifier.h"
+
+#include <atomic>
+#include <numeric>
+#include <tuple>
+#ifdef __linux__
+    #include <pthread.h>
+    #include <sched.h>
+    #include <sys/mman.h>
+#endif
 
 namespace planning
 {
@@ -26,17 +41,27 @@ namespace planning
             void outputPlannerData(const std::string &filename, bool output_states_and_paths = true, bool append_output = false) const override;
             
 		protected:
+            void setRealTimeAttributes();
+            void addRoutineTime(float time, size_t idx);
+            void addIterationTime();
             void generateHorizon();
             void updateHorizon(float d_c);
             void generateGBur();
+            void computeProcessingOrder();
             void shortenHorizon(size_t num);
             void addRandomStates(size_t num);
             void addLateralStates();
             bool modifyState(std::shared_ptr<planning::drbt::HorizonState> &q, size_t max_num_attempts);
+            void computeRandomCoord(Eigen::VectorXf &coord);
+            bool saturateAndPrune(Eigen::VectorXf &coord);
             void computeReachedState(const std::shared_ptr<planning::drbt::HorizonState> q);
             void computeNextState();
             int getIndexInHorizon(const std::shared_ptr<planning::drbt::HorizonState> q);
             float updateCurrentState();
+            void collectSplineWaypoints();
+            std::shared_ptr<planning::trajectory::Spline4> computeEmergencyStop(const std::shared_ptr<planning::trajectory::Spline> spline, float t);
+            bool validateSpline(const std::shared_ptr<planning::trajectory::Spline> spline, float t_begin, float t_end, 
+                                float delta_time, float max_time);
             void updateCurrentState2();
             bool changeNextState(std::vector<std::shared_ptr<planning::drbt::HorizonState>> &visited_states);
             void clearHorizon(base::State::Status status_, bool replanning_);
@@ -62,6 +87,35 @@ namespace planning
             float delta_q_max;                                                      // Maximal edge length when acquiring a new predefined path
             std::shared_ptr<planning::trajectory::Spline> spline_current;           // Current spline that 'q_current' is following in the current iteration
             std::shared_ptr<planning::trajectory::Spline> spline_next;              // Next spline that 'q_current' will follow until the end of current iteration
+            std::vector<Eigen::VectorXf> spline_waypoints;                          // Waypoints through which 'spline_next' is required to pass
+            std::shared_ptr<planning::trajectory::BrakingTable> braking_table;      // Precomputed braking times and distances for an emergency stop
+            std::shared_ptr<planning::trajectory::SplinePool> spline_pool;          // Pool from which all splines are taken
+            std::shared_ptr<planning::WorkerPool> worker_pool;                      // Fixed pool of workers for computing the horizon spines in parallel
+            std::shared_ptr<planning::PathSimplifier> path_simplifier;              // Simplifier of each new predefined path
+            std::shared_ptr<planning::drbt::HorizonStatePool> horizon_state_pool;   // Pool from which all horizon states are taken
+            Eigen::VectorXf limits_lower;                                           // Lower joint limits
+            Eigen::VectorXf limits_upper;                                           // Upper joint limits
+            Eigen::VectorXf coord_new;                                              // Preallocated coordinates of a new horizon state
+            Eigen::VectorXf coord_rand;                                             // Preallocated random vector used when modifying a state
+            Eigen::VectorXf coord_pruned;                                           // Preallocated coordinates used when pruning a spine
+            Eigen::VectorXf robot_max_vel;                                          // Maximal velocity of each robot's joint
+            Eigen::VectorXf coord_spline;                                           // Preallocated position of the robot on a spline
+            Eigen::VectorXf vel_spline;                                             // Preallocated velocity of the robot on a spline
+            Eigen::VectorXf acc_spline;                                             // Preallocated acceleration of the robot on a spline
+            std::shared_ptr<base::State> q_check;                                   // Preallocated state whose validity is checked on a spline
+            std::shared_ptr<base::State> q_check_max_vel;                           // Preallocated state reached from 'q_check' with maximal velocities in one second
+            Eigen::VectorXf check_times;                                            // Preallocated times of motion validity checks
+            Eigen::MatrixXf check_positions_current;                                // Preallocated positions on 'spline_current' at 'check_times'
+            Eigen::MatrixXf check_positions_next;                                   // Preallocated positions on 'spline_next' at 'check_times'
+            planning::drbt::HorizonBlock horizon_block;                             // Data of horizon states used for computing the next state
+            std::vector<size_t> processing_order;                                   // Indices of horizon states in the order in which they are processed
+            std::vector<size_t> states_to_modify;                                   // Indices of bad and critical horizon states that are going to be modified
+            std::vector<float> reach_times;                                         // Time in [s] needed to compute the spine for each horizon state (-1 if not processed)
+            std::vector<std::shared_ptr<planning::drbt::HorizonState>> visited_states;  // States visited when changing 'q_next' (see 'changeNextState')
+            float reach_time_avg;                                                   // Running average of time in [s] needed to compute a single spine
+
+            static constexpr float REACH_TIME_SMOOTHING { 0.1 };                    // Smoothing factor for 'reach_time_avg'
+            static constexpr size_t MAX_NUM_RANDOM_ATTEMPTS { 100 };                // Maximal number of attempts to generate a random horizon state
         };
     }
 }
@@ -18,6 +18,8 @@ namespace planning
             HorizonState(const std::shared_ptr<base::State> state_, int index_);
             ~HorizonState() {}
 
+            void reset(const std::shared_ptr<base::State> state_, int index_);
+
             enum class Status {Good, Bad, Critical, Goal};
 
             inline std::shared_ptr<base::State> getState() const { return state; }
@@ -30,6 +32,8 @@ namespace planning
             inline const Eigen::VectorXf &getCoord() const { return state->getCoord(); }
             inline float getCoord(size_t idx) const { return state->getCoord(idx); }
             inline bool getIsReached() const { return is_reached; }
+            inline bool getIsLateral() const { return is_lateral; }
+            inline int getHandle() const { return handle; }
 
             inline void setStateReached(const std::shared_ptr<base::State> state_reached_) { state_reached = state_reached_; }
             inline void setStatus(Status status_) { status = status_; }
@@ -38,6 +42,8 @@ namespace planning
             inline void setDistancePrevious(float d_c_previous_) { d_c_previous = d_c_previous_; }
             void setWeight(float weight_);
             inline void setIsReached(bool is_reached_) { is_reached = is_reached_; }
+            inline void setIsLateral(bool is_lateral_) { is_lateral = is_lateral_; }
+            inline void setHandle(int handle_) { handle = handle_; }
 
             friend std::ostream &operator<<(std::ostream &os, const std::shared_ptr<planning::drbt::HorizonState> q);
 
@@ -50,6 +56,24 @@ namespace planning
             float d_c_previous;                             // 'd_c' from previous iteration
             float weight;                                   // Weight in range [0, 1] for 'state_reached'
             bool is_reached;                                // Whether 'state_reached' == 'state'
+            bool is_lateral;                                // Whether 'state' is a lateral state
+            int handle;                                     // Position in the horizon, i.e., in 'HorizonBlock'. It is -1 if not assigned
+        };
+
+        // Structure-of-arrays block with data of all horizon states. It is reused through iterations, 
+        // and it is reallocated only when the number of horizon states exceeds its capacity.
+        struct HorizonBlock
+        {
+            Eigen::MatrixXf coord_reached;                  // Coordinates of reached states (column-wise)
+            Eigen::VectorXf d_c;
+            Eigen::VectorXf d_c_previous;
+            Eigen::VectorXf weight;
+            Eigen::VectorXf dist_to_goal;                   // Distance in C-space from reached states to the goal
+            Eigen::VectorXi index;                          // Index in the predefined path
+            Eigen::VectorXi status;                         // Status casted to int
+
+            void reserve(size_t num_states, size_t num_dimensions);
+            inline size_t getCapacity() const { return d_c.size(); }
         };
     }
 }
@@ -0,0 +1,41 @@
+//
+// Created by agent on 19.10.26.
+//
+#ifndef RPMPL_HORIZONSTATEPOOL_H
+#define RPMPL_HORIZONSTATEPOOL_H
+
+#include "StateSpace.h"
+#include "HorizonState.h"
+
+namespace planning
+{
+    namespace drbt
+    {
+        // Pool of horizon states with a fixed capacity, which are recycled in-place instead of being allocated in each iteration.
+        // A horizon state is free when it is not referenced outside the pool. 
+        // Each horizon state owns a state, whose coordinates can be overwritten for random, lateral and modified states.
+        class HorizonStatePool
+        {
+        public:
+            HorizonStatePool(const std::shared_ptr<base::StateSpace> ss_, size_t capacity);
+            ~HorizonStatePool() {}
+
+            inline size_t getCapacity() const { return horizon_states.size(); }
+            inline size_t getNumAllocations() const { return num_allocations; }
+
+            std::shared_ptr<planning::drbt::HorizonState> acquire(const std::shared_ptr<base::State> state, int index);
+            std::shared_ptr<planning::drbt::HorizonState> acquire(const Eigen::VectorXf &coord);
+
+        private:
+            size_t getFreeSlot();
+
+            std::shared_ptr<base::StateSpace> ss;
+            std::vector<std::shared_ptr<planning::drbt::HorizonState>> horizon_states;
+            std::vector<std::shared_ptr<base::State>> states;       // State owned by each horizon state
+            size_t next_slot;                                       // Slot from which the search for a free slot starts
+            size_t num_allocations;                                 // Number of allocations after the pool is created (when the pool is exhausted)
+        };
+    }
+}
+
+#endif //RPMPL_HORIZONSTATEPOOL_H
@@ -5,6 +5,10 @@
 #define RPMPL_RGBMTSTAR_H
 
 #include "RGBTConnect.h"
+#include "WorkerPool.h"
+
+#include <atomic>
+#include <random>
 
 namespace planning
 {
@@ -26,6 +30,10 @@ namespace planning
             std::vector<size_t> num_states;             // Total number of states for each tree
             float cost_opt;                             // Cost of the final path 
             std::shared_ptr<base::State> q_con_opt;     // State (takes start or goal conf.) from which the optimal path is constructed
+            std::shared_ptr<planning::WorkerPool> worker_pool;  // Pool of workers for attempting connections in parallel
+            float cost_pruned;                          // Path cost for which the trees were pruned the last time
+            size_t num_states_pruned;                   // Total number of pruned states
+            std::mt19937 generator;                     // Random number generator for informed sampling
 	
 			std::tuple<base::State::Status, std::shared_ptr<base::State>> connectGenSpine
                 (const std::shared_ptr<base::State> q, const std::shared_ptr<base::State> q_e);
@@ -36,8 +44,14 @@ namespace planning
                             const std::shared_ptr<base::State> q0_con);
             void deleteTrees(const std::vector<size_t> &trees_connected);
             std::shared_ptr<base::State> getRandomState();
+            std::shared_ptr<base::State> getInformedState();
+            float computeCostLowerBound(const std::shared_ptr<base::State> q);
+            void pruneTrees();
             void computePath(std::shared_ptr<base::State> q_con);
     
+            static constexpr float PRUNING_TOLERANCE { 1e-3 };     // States whose cost lower bound exceeds 'cost_opt' at least for this value are pruned
+            static constexpr size_t MAX_NUM_INFORMED_SAMPLES { 100 };  // Maximal number of informed samples until one within joint limits is found
+
         private:
             void considerChildren(const std::shared_ptr<base::State> q, const std::shared_ptr<base::Tree> tree0,
                                   const std::shared_ptr<base::State> q0_con, const std::shared_ptr<base::State> q_considered);
@@ -0,0 +1,89 @@
+//
+// Created by agent on 19.10.26.
+//
+#ifndef RPMPL_COMPOSITESPLINE_H
+#define RPMPL_COMPOSITESPLINE_H
+
+#include "Spline5.h"
+
+namespace planning
+{
+    namespace trajectory
+    {
+        /// @brief Trajectory through a sequence of waypoints, which consists of quintic subsplines.
+        /// Robot passes through all waypoints with non-zero (via) velocities, and stops only at the last one.
+        class CompositeSpline : public Spline
+        {
+        public:
+            CompositeSpline(const std::shared_ptr<robots::AbstractRobot> robot_, const Eigen::VectorXf &q_current,
+                            const Eigen::VectorXf &q_current_dot, const Eigen::VectorXf &q_current_ddot);
+		    ~CompositeSpline() {}
+
+            void reset(const Eigen::VectorXf &q_current, const Eigen::VectorXf &q_current_dot, const Eigen::VectorXf &q_current_ddot);
+
+            bool compute(const Eigen::VectorXf &q_final) override;
+            bool compute(const std::vector<Eigen::VectorXf> &waypoints_,
+                         const std::shared_ptr<planning::trajectory::CompositeSpline> spline_previous = nullptr);
+            bool checkConstraints(size_t idx, float t_f) override;
+
+            std::vector<float> getMaxVelocityTimes(size_t idx) override;
+            std::vector<float> getMaxAccelerationTimes(size_t idx) override;
+            std::vector<float> getMaxJerkTimes(size_t idx) override;
+
+            using Spline::getPosition;
+            using Spline::getVelocity;
+            using Spline::getAcceleration;
+
+            Eigen::VectorXf getPosition(float t) override;
+            float getPosition(float t, size_t idx) override;
+            float getPosition(float t, size_t idx, float t_f) override;
+
+            Eigen::VectorXf getVelocity(float t) override;
+            float getVelocity(float t, size_t idx) override;
+            float getVelocity(float t, size_t idx, float t_f) override;
+
+            Eigen::VectorXf getAcceleration(float t) override;
+            float getAcceleration(float t, size_t idx) override;
+            float getAcceleration(float t, size_t idx, float t_f) override;
+
+            Eigen::VectorXf getJerk(float t) override;
+            float getJerk(float t, size_t idx) override;
+            float getJerk(float t, size_t idx, float t_f) override;
+
+            void evaluate(const Eigen::VectorXf &times, Eigen::MatrixXf &out, size_t derivative = 0) override;
+
+            inline size_t getNumSubsplines() const { return subsplines.size(); }
+            inline const std::vector<Eigen::VectorXf> &getWaypoints() const { return waypoints; }
+            inline const std::vector<Eigen::VectorXf> &getViaVelocities() const { return via_velocities; }
+            inline const std::vector<float> &getTimesConnecting() const { return times_connecting; }
+
+            static constexpr float VIA_VELOCITY_SCALE { 0.8 };     // Scale of the estimated via velocity, leaving a margin for the maximal velocity
+            static constexpr float VIA_VELOCITY_MIN { 0.1 };       // Via velocity whose norm is smaller is set to zero instead of being halved
+
+        private:
+            void computeViaVelocities();
+            bool computeSubspline(size_t k, const std::shared_ptr<planning::trajectory::CompositeSpline> spline_previous);
+            std::shared_ptr<planning::trajectory::Spline> findSubspline(size_t k,
+                const std::shared_ptr<planning::trajectory::CompositeSpline> spline_previous);
+            size_t getSubsplineIndex(float &t);
+            std::shared_ptr<planning::trajectory::Spline5> acquireSubspline(const Eigen::VectorXf &q_begin_, 
+                const Eigen::VectorXf &q_begin_dot_, const Eigen::VectorXf &q_begin_ddot_);
+
+            Eigen::VectorXf q_start, q_start_dot, q_start_ddot;                     // Initial state of the robot
+            std::vector<Eigen::VectorXf> waypoints;                                 // Waypoints through which the robot passes
+            std::vector<Eigen::VectorXf> via_velocities;                            // Velocity of the robot at each waypoint
+            std::vector<std::shared_ptr<planning::trajectory::Spline>> subsplines;  // 'k'-th subspline ends at 'k'-th waypoint
+            std::vector<float> times_connecting;                                    // Time instances in [s] when each subspline begins
+
+            // Preallocated storage, such that a spline computed again (after 'reset') does not allocate any memory
+            std::vector<std::shared_ptr<planning::trajectory::Spline5>> subsplines_owned;  // Subsplines computed by this spline, recycled when not referenced elsewhere
+            std::vector<float> segment_times;                                       // Minimal time needed to traverse each segment
+            Eigen::VectorXf q_begin, q_begin_ddot;                                  // Initial position and acceleration of a subspline
+            Eigen::VectorXf q_final_dot;                                            // Final velocity of a subspline
+            Eigen::MatrixXf out_subspline;                                          // Output of 'evaluate' for a single subspline
+            Eigen::VectorXf times_subspline;                                        // Local times of a single subspline used in 'evaluate'
+        };
+    }
+}
+
+#endif //RPMPL_COMPOSITESPLINE_H
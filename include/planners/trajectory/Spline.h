@@ -25,22 +25,28 @@ namespace planning
             virtual std::vector<float> getMaxAccelerationTimes(size_t idx) = 0;
             virtual std::vector<float> getMaxJerkTimes(size_t idx) = 0;
 
-            Eigen::VectorXf getPosition(float t);
-            float getPosition(float t, size_t idx);
+            virtual Eigen::VectorXf getPosition(float t);
+            virtual float getPosition(float t, size_t idx);
             virtual float getPosition(float t, size_t idx, float t_f) = 0;
 
-            Eigen::VectorXf getVelocity(float t);
-            float getVelocity(float t, size_t idx);
+            virtual Eigen::VectorXf getVelocity(float t);
+            virtual float getVelocity(float t, size_t idx);
             virtual float getVelocity(float t, size_t idx, float t_f) = 0;
 
-            Eigen::VectorXf getAcceleration(float t);
-            float getAcceleration(float t, size_t idx);
+            virtual Eigen::VectorXf getAcceleration(float t);
+            virtual float getAcceleration(float t, size_t idx);
             virtual float getAcceleration(float t, size_t idx, float t_f) = 0;
 
-            Eigen::VectorXf getJerk(float t);
-            float getJerk(float t, size_t idx);
+            virtual Eigen::VectorXf getJerk(float t);
+            virtual float getJerk(float t, size_t idx);
             virtual float getJerk(float t, size_t idx, float t_f) = 0;
 
+            void getPosition(float t, Eigen::VectorXf &q);
+            void getVelocity(float t, Eigen::VectorXf &q);
+            void getAcceleration(float t, Eigen::VectorXf &q);
+
+            virtual void evaluate(const Eigen::VectorXf &times, Eigen::MatrixXf &out, size_t derivative = 0);
+
             float getCoeff(size_t i, size_t j) const { return coeff(i, j); }
             float getTimeFinal() const { return time_final; }
             float getTimeCurrent() const { return time_current; }
@@ -55,6 +61,8 @@ namespace planning
             friend std::ostream &operator<<(std::ostream &os, const std::shared_ptr<planning::trajectory::Spline> spline);
 
         protected:            
+            void reset(const Eigen::VectorXf &q_current);
+
             size_t order;
             size_t num_dimensions;
             std::shared_ptr<robots::AbstractRobot> robot;
@@ -64,6 +72,7 @@ namespace planning
             float time_current;                                 // Elapsed time in [s] from a time instant when a spline is created. It is used to determine a current robot's position, velocity and acceleration. 
             float time_begin;                                   // Time instance in [s] when a spline begins in the current iteration
             float time_end;                                     // Time instance in [s] when a spline ends in the current iteration
+            Eigen::MatrixXf coeff_der;                          // Preallocated coefficients of a derivative used in 'evaluate'
         };
         
     }
@@ -0,0 +1,90 @@
+//
+// Created by agent on 19.10.26.
+//
+#ifndef RPMPL_SPLINE4_H
+#define RPMPL_SPLINE4_H
+
+#include <array>
+
+#include "Spline.h"
+
+namespace planning
+{
+    namespace trajectory
+    {
+        /// @brief Precomputed braking times for each robot's joint, on a grid of initial velocities and accelerations.
+        /// Only non-negative velocities are stored, since braking with '(-vel, -acc)' is symmetric to braking with '(vel, acc)'.
+        class BrakingTable
+        {
+        public:
+            BrakingTable(const std::shared_ptr<robots::AbstractRobot> robot_, size_t num_vel_ = 64, size_t num_acc_ = 33);
+            ~BrakingTable() {}
+
+            float getTime(size_t idx, float vel, float acc) const;
+            float getDistance(size_t idx, float vel, float acc) const;
+
+            static float computeTime(float vel, float acc, float max_acc, float max_jerk);
+            static float computeDistance(float vel, float acc, float t_f);
+            static bool checkConstraints(float vel, float acc, float t_f, float max_acc, float max_jerk);
+
+        private:
+            bool findCell(size_t idx, float vel, float acc, size_t &i, size_t &j) const;
+
+            std::shared_ptr<robots::AbstractRobot> robot;
+            size_t num_vel;                             // Number of grid velocities in [0, max_vel]
+            size_t num_acc;                             // Number of grid accelerations in [-max_acc, max_acc]
+            std::vector<Eigen::MatrixXf> times;         // 'times[idx](i, j)' is the braking time in [s] of 'idx'-th joint for 'i'-th velocity and 'j'-th acceleration
+        };
+
+        /// @brief Quartic spline which stops the robot as fast as possible (emergency brake),
+        /// such that constraints on robot's maximal acceleration and jerk are satisfied.
+        /// Each joint stops independently at its own braking time, after which its velocity and acceleration are zero.
+        class Spline4 : public Spline
+        {
+        public:
+            Spline4(const std::shared_ptr<robots::AbstractRobot> robot_, const Eigen::VectorXf &q_current,
+                    const Eigen::VectorXf &q_current_dot, const Eigen::VectorXf &q_current_ddot,
+                    const std::shared_ptr<planning::trajectory::BrakingTable> braking_table_ = nullptr);
+		    ~Spline4() {}
+
+            void reset(const Eigen::VectorXf &q_current, const Eigen::VectorXf &q_current_dot, const Eigen::VectorXf &q_current_ddot);
+
+            bool compute();
+            bool compute(const Eigen::VectorXf &q_final) override;
+            bool checkConstraints(size_t idx, float t_f) override;
+
+            std::vector<float> getMaxVelocityTimes(size_t idx) override;
+            std::vector<float> getMaxAccelerationTimes(size_t idx) override;
+            std::vector<float> getMaxJerkTimes(size_t idx) override;
+
+            using Spline::getPosition;
+            using Spline::getVelocity;
+            using Spline::getAcceleration;
+            using Spline::getJerk;
+
+            float getPosition(float t, size_t idx) override;
+            float getPosition(float t, size_t idx, float t_f) override;
+            float getVelocity(float t, size_t idx) override;
+            float getVelocity(float t, size_t idx, float t_f) override;
+            float getAcceleration(float t, size_t idx) override;
+            float getAcceleration(float t, size_t idx, float t_f) override;
+            float getJerk(float t, size_t idx) override;
+            float getJerk(float t, size_t idx, float t_f) override;
+
+            void evaluate(const Eigen::VectorXf &times, Eigen::MatrixXf &out, size_t derivative = 0) override;
+
+            using Spline::getTimeFinal;
+            inline float getTimeFinal(size_t idx) const { return times_final(idx); }
+
+        private:
+            void computeCoefficients(size_t idx, float t_f);
+            size_t getMaxVelocityTimes(size_t idx, std::array<float, 2> &t_max);
+
+            std::shared_ptr<planning::trajectory::BrakingTable> braking_table;
+            Eigen::VectorXf b, c, d, e, f;      // Coefficients of a spline b*t⁴ + c*t³ + d*t² + e*t + f
+            Eigen::VectorXf times_final;        // Braking time in [s] for each joint
+        };
+    }
+}
+
+#endif //RPMPL_SPLINE4_H
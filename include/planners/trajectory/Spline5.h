@@ -4,6 +4,8 @@
 #ifndef RPMPL_SPLINE5_H
 #define RPMPL_SPLINE5_H
 
+#include <array>
+
 #include "Spline.h"
 
 namespace planning
@@ -18,7 +20,10 @@ namespace planning
                     const Eigen::VectorXf &q_current_dot, const Eigen::VectorXf &q_current_ddot);
 		    ~Spline5() {}
 
+            void reset(const Eigen::VectorXf &q_current, const Eigen::VectorXf &q_current_dot, const Eigen::VectorXf &q_current_ddot);
+
             bool compute(const Eigen::VectorXf &q_final) override;
+            bool compute(const Eigen::VectorXf &q_final, const Eigen::VectorXf &q_final_dot);
             bool checkConstraints(size_t idx, float t_f) override;
 
             std::vector<float> getMaxVelocityTimes(size_t idx) override;
@@ -30,9 +35,24 @@ namespace planning
             float getAcceleration(float t, size_t idx, float t_f) override;
             float getJerk(float t, size_t idx, float t_f) override;
 
-        private:
+            static constexpr size_t MAX_NUM_DOFS { 16 };   // Maximal number of DOFs for which all joints are solved at once
+
+        protected:
+            // Array with a value for each joint, which is stored on the stack (without any allocation). 
+            // It can hold at most 'MAX_NUM_DOFS' joints, so batch routines must not be used for robots with more joints.
+            typedef Eigen::Array<float, Eigen::Dynamic, 1, Eigen::ColMajor, MAX_NUM_DOFS, 1> ArrayJ;
+            typedef Eigen::Array<bool, Eigen::Dynamic, 1, Eigen::ColMajor, MAX_NUM_DOFS, 1> ArrayJb;
+            static_assert(ArrayJ::MaxRowsAtCompileTime == MAX_NUM_DOFS && ArrayJb::MaxRowsAtCompileTime == MAX_NUM_DOFS);
+
             float computeFinalTime(size_t idx, float q_f_i);
-            const std::vector<float> solveQubicEquation(float a, float b, float c, float d);
+            bool computeCoefficients(const Eigen::VectorXf &q_final, const Eigen::VectorXf &q_final_dot, float t_f);
+            void computeFinalTimes(const ArrayJ &c_, const Eigen::VectorXf &q_final, ArrayJ &t_f, ArrayJ &a_, ArrayJ &b_);
+            ArrayJb checkConstraints(const ArrayJ &a_, const ArrayJ &b_, const ArrayJ &c_, const ArrayJ &t_f);
+            size_t getMaxVelocityTimes(size_t idx, std::array<float, 3> &t_max);
+            size_t getMaxAccelerationTimes(size_t idx, std::array<float, 3> &t_max);
+            size_t getMaxJerkTimes(size_t idx, std::array<float, 3> &t_max);
+            size_t solveQubicEquation(float a, float b, float c, float d, std::array<float, 3> &roots);
+            void solveQubicEquations(const ArrayJ &a_, const ArrayJ &b_, const ArrayJ &c_, const ArrayJ &d_, std::array<ArrayJ, 3> &roots);
             
             Eigen::VectorXf a, b, c, d, e, f;   // Coefficients of a spline a*t⁵ + b*t⁴ + c*t³ + d*t² + e*t + f
         };
@@ -0,0 +1,48 @@
+//
+// Created by agent on 19.10.26.
+//
+#ifndef RPMPL_SPLINEPOOL_H
+#define RPMPL_SPLINEPOOL_H
+
+#include "Spline5.h"
+#include "CompositeSpline.h"
+#include "Spline4.h"
+
+namespace planning
+{
+    namespace trajectory
+    {
+        /// @brief Pool of splines with a fixed capacity for each type of spline, which are reset in-place instead of being 
+        /// allocated in each iteration. A spline is free when it is not referenced outside the pool.
+        /// If all splines of some type are used, the pool is enlarged by one spline of that type.
+        class SplinePool
+        {
+        public:
+            SplinePool(const std::shared_ptr<robots::AbstractRobot> robot_, 
+                       const std::shared_ptr<planning::trajectory::BrakingTable> braking_table_, size_t capacity);
+            ~SplinePool() {}
+
+            inline size_t getNumAllocations() const { return num_allocations; }
+
+            std::shared_ptr<planning::trajectory::Spline5> acquireSpline5(const Eigen::VectorXf &q_current, 
+                const Eigen::VectorXf &q_current_dot, const Eigen::VectorXf &q_current_ddot);
+            std::shared_ptr<planning::trajectory::CompositeSpline> acquireCompositeSpline(const Eigen::VectorXf &q_current, 
+                const Eigen::VectorXf &q_current_dot, const Eigen::VectorXf &q_current_ddot);
+            std::shared_ptr<planning::trajectory::Spline4> acquireSpline4(const Eigen::VectorXf &q_current, 
+                const Eigen::VectorXf &q_current_dot, const Eigen::VectorXf &q_current_ddot);
+
+        private:
+            template <class T>
+            std::shared_ptr<T> getFreeSpline(const std::vector<std::shared_ptr<T>> &splines) const;
+
+            std::shared_ptr<robots::AbstractRobot> robot;
+            std::shared_ptr<planning::trajectory::BrakingTable> braking_table;          // Braking table of each emergency stop
+            std::vector<std::shared_ptr<planning::trajectory::Spline5>> splines5;
+            std::vector<std::shared_ptr<planning::trajectory::CompositeSpline>> composite_splines;
+            std::vector<std::shared_ptr<planning::trajectory::Spline4>> splines4;
+            size_t num_allocations;                                                     // Number of allocations after the pool is created (when the pool is exhausted)
+        };
+    }
+}
+
+#endif //RPMPL_SPLINEPOOL_H
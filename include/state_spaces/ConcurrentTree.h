@@ -0,0 +1,69 @@
+//
+// Created by agent on 19.10.26.
+//
+
+#ifndef RPMPL_CONCURRENTTREE_H
+#define RPMPL_CONCURRENTTREE_H
+
+#include <nanoflann.hpp>
+#include <atomic>
+#include <array>
+#include <vector>
+#include <memory>
+#include <string>
+
+#include "State.h"
+
+namespace base
+{
+	// Tree which supports parallel insertion of states by several threads, and nearest-neighbour queries during the insertion.
+	// States are stored in an append-only chunked array, so an inserted state never moves, and the first 'getNumStates()' states are always readable.
+	// Each thread has its own nearest-neighbour index, which is a list of immutable Kd-trees whose sizes are distinct powers of two
+	// (the logarithmic method). A new state is merged into the list by its owner, which then atomically publishes the new list,
+	// while a query searches the currently published lists of all threads. Thus, threads never wait for each other's searches 
+	// or merges. However, states are published in the order of their indices, so an insertion briefly spins until the preceding 
+	// ones are published, and 'std::atomic<std::shared_ptr>' itself is not lock-free in libstdc++ (it uses a short internal lock).
+	// Children lists are not maintained (only parents are set), since they cannot be modified concurrently.
+	class ConcurrentTree
+	{
+	public:
+		ConcurrentTree(const std::string &tree_name_, size_t tree_idx_, size_t num_threads_);
+		~ConcurrentTree();
+
+		inline const std::string &getTreeName() const { return tree_name; }
+		inline size_t getTreeIdx() const { return tree_idx; }
+		inline size_t getNumThreads() const { return num_threads; }
+		inline size_t getNumStates() const { return num_states.load(std::memory_order_acquire); }
+		std::shared_ptr<base::State> getState(size_t idx) const;
+
+		std::shared_ptr<base::State> getNearestState(const std::shared_ptr<base::State> q) const;
+		void upgradeTree(const std::shared_ptr<base::State> q_new, const std::shared_ptr<base::State> q_parent, size_t thread_idx);
+
+		static constexpr size_t CHUNK_SIZE { 1024 };			// Number of states in each chunk of the array
+		static constexpr size_t MAX_NUM_CHUNKS { 4096 };		// Maximal number of chunks, i.e., the capacity is 'CHUNK_SIZE' * 'MAX_NUM_CHUNKS' states
+		static constexpr size_t MIN_KD_TREE_SIZE { 16 };		// Smaller blocks of the index are searched by brute force
+
+	private:
+		class Block;
+		typedef std::array<std::shared_ptr<base::State>, CHUNK_SIZE> Chunk;
+		typedef std::vector<std::shared_ptr<const Block>> Blocks;
+
+		// Per-thread index, which is aligned to the cache line to avoid false sharing between the threads
+		struct alignas(64) Index
+		{
+			std::atomic<std::shared_ptr<const Blocks>> blocks;
+		};
+
+		Chunk *getChunk(size_t chunk_idx);
+
+		std::string tree_name;
+		size_t tree_idx;
+		size_t num_threads;
+		std::vector<std::atomic<Chunk*>> chunks;
+		std::atomic<size_t> num_reserved;		// Number of reserved places in the array
+		std::atomic<size_t> num_states;			// Number of published states, which is at most 'num_reserved'
+		std::vector<Index> indexes;
+	};
+}
+
+#endif //RPMPL_CONCURRENTTREE_H
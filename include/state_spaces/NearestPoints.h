@@ -0,0 +1,34 @@
+//
+// Created by agent on 19.10.26.
+//
+
+#ifndef RPMPL_NEARESTPOINTS_H
+#define RPMPL_NEARESTPOINTS_H
+
+#include <Eigen/Dense>
+
+namespace base
+{
+	// Nearest points between each robot's link and each obstacle, stored in a single flat buffer in obstacle-major order.
+	// A block is computed once per distance computation, and then shared (via 'std::shared_ptr') by all states derived from it.
+	class NearestPoints
+	{
+	private:
+		size_t num_obstacles;
+		size_t num_links;
+		Eigen::Matrix<float, 6, Eigen::Dynamic> points;		// Column 'j * num_links + i' corresponds to (j-th obstacle, i-th link). 
+															// Its first three elements are robot nearest point, and last three are obstacle nearest point
+	public:
+		NearestPoints(size_t num_obstacles_, size_t num_links_);
+		~NearestPoints() {}
+
+		inline size_t getNumObstacles() const { return num_obstacles; }
+		inline size_t getNumLinks() const { return num_links; }
+		inline auto getPoints(size_t obs_idx, size_t link_idx) { return points.col(obs_idx * num_links + link_idx); }
+		inline auto getPoints(size_t obs_idx, size_t link_idx) const { return points.col(obs_idx * num_links + link_idx); }
+		inline auto getRobotPoint(size_t obs_idx, size_t link_idx) const { return getPoints(obs_idx, link_idx).head<3>(); }
+		inline auto getObstaclePoint(size_t obs_idx, size_t link_idx) const { return getPoints(obs_idx, link_idx).tail<3>(); }
+	};
+}
+
+#endif //RPMPL_NEARESTPOINTS_H
@@ -11,6 +11,8 @@
 #include <memory>
 
 #include "StateSpaceType.h"
+#include "NearestPoints.h"
+
 namespace base
 {
 	class State
@@ -24,12 +26,17 @@ namespace base
 		Eigen::VectorXf coord;											// Coordinates in C-space
 		size_t tree_idx;												// Tree index in which the state is stored
 		size_t idx; 													// Index of the state in the tree
+		size_t child_idx;												// Index of the state in the list of children of its parent
 		float d_c;														// Distance-to-obstacles
 		std::vector<float> d_c_profile; 								// Distance-to-obstacles for each robot's link
 		bool is_real_d_c;												// Is real or underestimation of distance-to-obstacles used
+		float d_c_predicted;											// Distance-to-obstacles at their predicted positions (see 'computeDistanceAt')
+		size_t env_version;												// Environment version in which the real distance-to-obstacles is computed
 		float cost;                  									// Cost-to-come
-		std::shared_ptr<std::vector<Eigen::MatrixXf>> nearest_points;	// Set of nearest points between each robot segment and each obstacle
-		std::shared_ptr<State> parent;
+		std::shared_ptr<base::NearestPoints> nearest_points;			// Nearest points between each robot segment and each obstacle
+		std::shared_ptr<Eigen::MatrixXf> d_c_obstacles;					// Distance-to-obstacles for each pair (robot's link, obstacle), where j-th column 
+																		// corresponds to j-th obstacle, and its last element is the environment time of computing
+		std::weak_ptr<State> parent;									// Non-owning, since the parent (or the tree) owns its children
 		std::shared_ptr<std::vector<std::shared_ptr<State>>> children;
 		
 	public:
@@ -43,12 +50,16 @@ namespace base
 		inline float getCoord(size_t idx) const { return coord(idx); }
 		inline size_t getTreeIdx() const { return tree_idx; }
 		inline size_t getIdx() const { return idx; }
+		inline size_t getChildIdx() const { return child_idx; }
 		inline float getDistance() const { return d_c; }
 		inline const std::vector<float> &getDistanceProfile() const {return d_c_profile; }
 		inline bool getIsRealDistance() const { return is_real_d_c; }
+		inline float getDistancePredicted() const { return d_c_predicted; }
+		inline size_t getEnvVersion() const { return env_version; }
 		inline float getCost() const { return cost; }
-		inline std::shared_ptr<std::vector<Eigen::MatrixXf>> getNearestPoints() const { return nearest_points; }
-		inline std::shared_ptr<State> getParent() const { return parent; }
+		inline std::shared_ptr<base::NearestPoints> getNearestPoints() const { return nearest_points; }
+		inline std::shared_ptr<Eigen::MatrixXf> getDistanceObstacles() const { return d_c_obstacles; }
+		inline std::shared_ptr<State> getParent() const { return parent.lock(); }
 		inline std::shared_ptr<std::vector<std::shared_ptr<State>>> getChildren() const { return children; };
 
 		inline void setStateSpaceType(base::StateSpaceType state_space_type_) { state_space_type = state_space_type_; }
@@ -57,15 +68,20 @@ namespace base
 		inline void setCoord(const float coord_, size_t idx) { coord(idx) = coord_; }
 		inline void setTreeIdx(size_t tree_idx_) { tree_idx = tree_idx_; }
 		inline void setIdx(size_t idx_) { idx = idx_; }
+		inline void setChildIdx(size_t child_idx_) { child_idx = child_idx_; }
 		inline void setDistance(float d_c_) { d_c = d_c_; }
 		inline void setDistanceProfile(const std::vector<float> &d_c_profile_) { d_c_profile = d_c_profile_; }
 		inline void setIsRealDistance(bool is_real_d_c_) { is_real_d_c = is_real_d_c_; }
+		inline void setDistancePredicted(float d_c_predicted_) { d_c_predicted = d_c_predicted_; }
+		inline void setEnvVersion(size_t env_version_) { env_version = env_version_; }
 		inline void setCost(float cost_) { cost = cost_; }
-		inline void setNearestPoints(const std::shared_ptr<std::vector<Eigen::MatrixXf>> nearest_points_) { nearest_points = nearest_points_; }
+		inline void setNearestPoints(const std::shared_ptr<base::NearestPoints> nearest_points_) { nearest_points = nearest_points_; }
+		inline void setDistanceObstacles(const std::shared_ptr<Eigen::MatrixXf> d_c_obstacles_) { d_c_obstacles = d_c_obstacles_; }
 		inline void setParent(const std::shared_ptr<State> parent_) { parent = parent_; }
 		inline void setChildren(const std::shared_ptr<std::vector<std::shared_ptr<State>>> children_) { children = children_; }
 
 		void addChild(const std::shared_ptr<State> child);
+		void removeChild(const std::shared_ptr<State> child);
 		friend std::ostream &operator<<(std::ostream &os, const std::shared_ptr<base::State> state);
 	};
 }
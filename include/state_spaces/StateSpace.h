@@ -25,6 +25,8 @@ namespace base
 		inline void setStateSpaceType(base::StateSpaceType state_space_type_) { state_space_type = state_space_type_; };
 		inline size_t getNumDimensions() { return num_dimensions; }
 		inline virtual base::StateSpaceType getStateSpaceType() const { return state_space_type; };
+		// Whether validity and distance checks can be called concurrently from several threads
+		inline virtual bool isReentrant() const { return true; }
 		virtual std::shared_ptr<base::State> getRandomState(const std::shared_ptr<base::State> q_center = nullptr) = 0;
 		virtual std::shared_ptr<base::State> getNewState(const std::shared_ptr<base::State> q) = 0;
 		virtual std::shared_ptr<base::State> getNewState(const Eigen::VectorXf &coord) = 0;
@@ -43,8 +45,10 @@ namespace base
 		virtual bool isValid(const std::shared_ptr<base::State> q) = 0;
 		virtual bool isValid(const std::shared_ptr<base::State> q1, const std::shared_ptr<base::State> q2) = 0;
 		virtual float computeDistance(const std::shared_ptr<base::State> q, bool compute_again = false) = 0;
+		virtual bool isValidAt(const std::shared_ptr<base::State> q, float t) = 0;
+		virtual float computeDistanceAt(const std::shared_ptr<base::State> q, float t) = 0;
 		virtual float computeDistanceUnderestimation(const std::shared_ptr<base::State> q, 
-			const std::shared_ptr<std::vector<Eigen::MatrixXf>> nearest_points) = 0;
+			const std::shared_ptr<base::NearestPoints> nearest_points) = 0;
 	};
 }
 
@@ -6,9 +6,11 @@
 #define RPMPL_TREE_H
 
 #include <nanoflann.hpp>
+#include <functional>
 
 #include "State.h"
 #include "StateSpaceType.h"
+#include "NearestNeighbours.h"
 
 namespace base
 {
@@ -22,7 +24,7 @@ namespace base
 		std::string tree_name;
 		size_t tree_idx;
 		std::shared_ptr<std::vector<std::shared_ptr<base::State>>> states; 	// List of all nodes in the tree
-        std::shared_ptr<base::KdTree> kd_tree;
+		std::shared_ptr<base::NearestNeighbours> nearest_neighbours;		// Index for nearest-neighbour queries
 
 	public:
 		Tree() {}
@@ -34,18 +36,18 @@ namespace base
 		inline size_t getTreeIdx() const { return tree_idx; }
 		inline std::shared_ptr<std::vector<std::shared_ptr<base::State>>> getStates() const { return states; }
 		inline std::shared_ptr<base::State> getState(size_t idx) const { return states->at(idx); }
-        inline std::shared_ptr<base::KdTree> getKdTree() const { return kd_tree; }
+		inline std::shared_ptr<base::NearestNeighbours> getNearestNeighbours() const { return nearest_neighbours; }
 		inline size_t getNumStates() const { return states->size(); }
 
 		inline void setTreeName(const std::string &tree_name_) { tree_name = tree_name_; }
 		inline void setTreeIdx(const size_t tree_idx_) { tree_idx = tree_idx_; }
 		inline void setStates(const std::shared_ptr<std::vector<std::shared_ptr<base::State>>> states_) { states = states_; }
 		inline void setState(const std::shared_ptr<base::State> state, size_t idx) { states->at(idx) = state; }
-        inline void setKdTree(const std::shared_ptr<base::KdTree> kdtree_) { kd_tree = kdtree_; }
+		inline void setNearestNeighbours(const std::shared_ptr<base::NearestNeighbours> nearest_neighbours_) { nearest_neighbours = nearest_neighbours_; }
 
 		void clearTree();
+		size_t pruneTree(const std::function<bool(const std::shared_ptr<base::State>)> &is_pruned);
 		std::shared_ptr<base::State> getNearestState(const std::shared_ptr<base::State> q);
-		std::shared_ptr<base::State> getNearestState2(const std::shared_ptr<base::State> q);
 		void upgradeTree(const std::shared_ptr<base::State> q_new, const std::shared_ptr<base::State> q_parent);
 		void upgradeTree(const std::shared_ptr<base::State> q_new, const std::shared_ptr<base::State> q_parent, 
 						 const std::shared_ptr<base::State> q_ref);
@@ -0,0 +1,37 @@
+//
+// Created by agent on 19.10.26.
+//
+
+#ifndef RPMPL_ADAPTIVENEARESTNEIGHBOURS_H
+#define RPMPL_ADAPTIVENEARESTNEIGHBOURS_H
+
+#include "NearestNeighbours.h"
+
+namespace base
+{
+	// Brute force is used while the tree is small (e.g., local trees in RGBMT*). In spaces with at most 'MAX_KD_TREE_DIMENSIONS' 
+	// dimensions, Kd-tree is built when the tree reaches 'MIN_KD_TREE_SIZE' states. In higher-dimensional spaces, brute force is always used.
+	// 'getType()' returns 'Adaptive', so the same wrapper is created when the index is rebuilt.
+	class AdaptiveNearestNeighbours : public base::NearestNeighbours
+	{
+	public:
+		AdaptiveNearestNeighbours(const base::Tree &tree_, size_t num_dimensions_);
+		~AdaptiveNearestNeighbours() {}
+
+		inline base::NearestNeighboursType getCurrentType() const { return nearest_neighbours->getType(); }
+		inline size_t getMinIndexSize() const { return min_index_size; }
+
+		void add(size_t idx) override;
+		size_t getNearestIdx(const Eigen::VectorXf &coord) override;
+		static size_t computeMinIndexSize(size_t num_dimensions_);
+
+		static constexpr size_t MIN_KD_TREE_SIZE { 1000 };
+		static constexpr size_t MAX_KD_TREE_DIMENSIONS { 8 };
+
+	private:
+		size_t min_index_size;
+		std::shared_ptr<base::NearestNeighbours> nearest_neighbours;
+	};
+}
+
+#endif //RPMPL_ADAPTIVENEARESTNEIGHBOURS_H
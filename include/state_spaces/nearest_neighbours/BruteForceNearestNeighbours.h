@@ -0,0 +1,39 @@
+//
+// Created by agent on 19.10.26.
+//
+
+#ifndef RPMPL_BRUTEFORCENEARESTNEIGHBOURS_H
+#define RPMPL_BRUTEFORCENEARESTNEIGHBOURS_H
+
+#include <vector>
+
+#include "NearestNeighbours.h"
+
+namespace base
+{
+	// Linear scan over coordinates of all states, using squared distances. It is the fastest choice for small trees, 
+	// since it has no overhead of building and traversing an index.
+	// States are stored contiguously in blocks of 'BLOCK_SIZE' states, where the same coordinates of all states from the block 
+	// are consecutive. Thus, distances to the whole block are computed at once by AVX2 instructions (if supported by the CPU).
+	class BruteForceNearestNeighbours : public base::NearestNeighbours
+	{
+	public:
+		BruteForceNearestNeighbours(const base::Tree &tree_, size_t num_dimensions_);
+		~BruteForceNearestNeighbours() {}
+
+		inline size_t getNumStates() const { return num_states; }
+
+		void add(size_t idx) override;
+		size_t getNearestIdx(const Eigen::VectorXf &coord) override;
+		size_t getNearestIdxScalar(const Eigen::VectorXf &coord) const;
+		size_t getNearestIdxAVX2(const Eigen::VectorXf &coord) const;
+
+		static constexpr size_t BLOCK_SIZE { 8 };		// Number of floats in AVX2 register
+
+	private:
+		std::vector<float> coords;		// k-th coordinate of i-th state is at [((i / BLOCK_SIZE) * num_dimensions + k) * BLOCK_SIZE + i % BLOCK_SIZE]
+		size_t num_states;
+	};
+}
+
+#endif //RPMPL_BRUTEFORCENEARESTNEIGHBOURS_H
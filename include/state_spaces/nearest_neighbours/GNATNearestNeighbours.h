@@ -0,0 +1,49 @@
+//
+// Created by agent on 19.10.26.
+//
+
+#ifndef RPMPL_GNATNEARESTNEIGHBOURS_H
+#define RPMPL_GNATNEARESTNEIGHBOURS_H
+
+#include <vector>
+
+#include "NearestNeighbours.h"
+
+namespace base
+{
+	// Geometric near-neighbour access tree (GNAT). Each internal node splits its states among 'DEGREE' children by the nearest pivot,
+	// and stores the range of distances from each pivot to the states of each child. A query prunes a child whenever these ranges 
+	// and the triangle inequality imply that it cannot contain a state closer than the current nearest one.
+	// Unlike Kd-tree, it relies only on the metric (not on coordinate axes), so it does not degrade that much in high-dimensional spaces.
+	class GNATNearestNeighbours : public base::NearestNeighbours
+	{
+	public:
+		GNATNearestNeighbours(const base::Tree &tree_, size_t num_dimensions_);
+		~GNATNearestNeighbours() {}
+
+		void add(size_t idx) override;
+		size_t getNearestIdx(const Eigen::VectorXf &coord) override;
+
+		static constexpr size_t DEGREE { 8 };				// Number of children of each internal node
+		static constexpr size_t MAX_LEAF_SIZE { 50 };		// Leaf is split when it contains more states
+
+	private:
+		struct Node
+		{
+			size_t pivot;								// Index of the pivot state (not used for the root)
+			std::vector<size_t> states;					// Indices of states if the node is a leaf
+			std::vector<std::unique_ptr<Node>> children;
+			std::vector<float> dist_min;				// Range of distances from the pivot of i-th child to the states
+			std::vector<float> dist_max;				// of j-th child is stored at [i * num_children + j]
+		};
+
+		float getDistance(size_t idx, const Eigen::VectorXf &coord) const;
+		void insert(Node *node, size_t idx);
+		void split(Node *node);
+		void search(const Node *node, const Eigen::VectorXf &coord, size_t &idx_nearest, float &dist_nearest) const;
+
+		std::unique_ptr<Node> root;
+	};
+}
+
+#endif //RPMPL_GNATNEARESTNEIGHBOURS_H
@@ -0,0 +1,30 @@
+//
+// Created by agent on 19.10.26.
+//
+
+#ifndef RPMPL_KDTREENEARESTNEIGHBOURS_H
+#define RPMPL_KDTREENEARESTNEIGHBOURS_H
+
+#include "NearestNeighbours.h"
+#include "Tree.h"
+
+namespace base
+{
+	// Dynamic Kd-tree from nanoflann library, which is efficient in low-dimensional spaces
+	class KdTreeNearestNeighbours : public base::NearestNeighbours
+	{
+	public:
+		KdTreeNearestNeighbours(const base::Tree &tree_, size_t num_dimensions_);
+		~KdTreeNearestNeighbours() {}
+
+		void add(size_t idx) override;
+		size_t getNearestIdx(const Eigen::VectorXf &coord) override;
+
+		static constexpr size_t MAX_LEAF_SIZE { 10 };
+
+	private:
+		std::shared_ptr<base::KdTree> kd_tree;
+	};
+}
+
+#endif //RPMPL_KDTREENEARESTNEIGHBOURS_H
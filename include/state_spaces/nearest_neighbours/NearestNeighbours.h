@@ -0,0 +1,39 @@
+//
+// Created by agent on 19.10.26.
+//
+
+#ifndef RPMPL_NEARESTNEIGHBOURS_H
+#define RPMPL_NEARESTNEIGHBOURS_H
+
+#include <memory>
+#include <Eigen/Dense>
+
+#include "NearestNeighboursType.h"
+
+namespace base
+{
+	class Tree;
+
+	// Index for nearest-neighbour queries over the states of 'tree', which is updated by the tree whenever a state is added
+	class NearestNeighbours
+	{
+	public:
+		NearestNeighbours(const base::Tree &tree_, size_t num_dimensions_);
+		virtual ~NearestNeighbours() = 0;
+
+		inline base::NearestNeighboursType getType() const { return type; }
+		inline size_t getNumDimensions() const { return num_dimensions; }
+		
+		virtual void add(size_t idx) = 0;		// State with index 'idx' is added to 'tree' (indices are added in increasing order)
+		virtual size_t getNearestIdx(const Eigen::VectorXf &coord) = 0;		// Index of the nearest state to 'coord' ('tree' must not be empty)
+
+		static std::shared_ptr<base::NearestNeighbours> create(base::NearestNeighboursType type_, const base::Tree &tree_, size_t num_dimensions_);
+
+	protected:
+		base::NearestNeighboursType type;
+		const base::Tree &tree;
+		size_t num_dimensions;
+	};
+}
+
+#endif //RPMPL_NEARESTNEIGHBOURS_H
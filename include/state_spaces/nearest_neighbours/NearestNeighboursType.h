@@ -0,0 +1,33 @@
+//
+// Created by agent on 19.10.26.
+//
+
+#ifndef RPMPL_NEARESTNEIGHBOURSTYPE_H
+#define RPMPL_NEARESTNEIGHBOURSTYPE_H
+
+#include <ostream>
+#include <string>
+#include <unordered_map>
+
+namespace base
+{
+	enum class NearestNeighboursType
+	{
+		KdTree,
+		GNAT,
+		BruteForce,
+		Adaptive
+	};
+
+	static std::unordered_map<std::string, base::NearestNeighboursType> nearest_neighbours_type_map = 
+	{
+		{ "KdTree", base::NearestNeighboursType::KdTree },
+		{ "GNAT", base::NearestNeighboursType::GNAT },
+		{ "BruteForce", base::NearestNeighboursType::BruteForce },
+		{ "Adaptive", base::NearestNeighboursType::Adaptive }
+	};
+
+	std::ostream &operator<<(std::ostream &os, const base::NearestNeighboursType &type);
+}
+
+#endif //RPMPL_NEARESTNEIGHBOURSTYPE_H
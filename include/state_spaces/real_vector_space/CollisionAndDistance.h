@@ -18,19 +18,19 @@ namespace base
     public:
         CollisionAndDistance() {}
 
-		static bool collisionCapsuleToBox(const Eigen::Vector3f &A, const Eigen::Vector3f &B, float radius, Eigen::VectorXf &obs);
-		static bool collisionCapsuleToRectangle(const Eigen::Vector3f &A, const Eigen::Vector3f &B, float radius, Eigen::VectorXf &obs, size_t coord);
+		static bool collisionCapsuleToBox(const Eigen::Vector3f &A, const Eigen::Vector3f &B, float radius, const Eigen::VectorXf &obs);
+		static bool collisionCapsuleToRectangle(const Eigen::Vector3f &A, const Eigen::Vector3f &B, float radius, const Eigen::VectorXf &obs, size_t coord);
 		static bool collisionLineSegToLineSeg(const Eigen::Vector3f &A, const Eigen::Vector3f &B, Eigen::Vector3f &C, Eigen::Vector3f &D);
-		static bool collisionCapsuleToSphere(const Eigen::Vector3f &A, const Eigen::Vector3f &B, float radius, Eigen::VectorXf &obs);
+		static bool collisionCapsuleToSphere(const Eigen::Vector3f &A, const Eigen::Vector3f &B, float radius, const Eigen::VectorXf &obs);
 
         static std::tuple<float, std::shared_ptr<Eigen::MatrixXf>> distanceCapsuleToBox
-			(const Eigen::Vector3f &A, const Eigen::Vector3f &B, float radius, Eigen::VectorXf &obs);
+			(const Eigen::Vector3f &A, const Eigen::Vector3f &B, float radius, const Eigen::VectorXf &obs);
 		static std::tuple<float, std::shared_ptr<Eigen::MatrixXf>> distanceLineSegToLineSeg
 			(const Eigen::Vector3f &A, const Eigen::Vector3f &B, const Eigen::Vector3f &C, const Eigen::Vector3f &D);
 		static std::tuple<float, std::shared_ptr<Eigen::MatrixXf>> distanceLineSegToPoint
 			(const Eigen::Vector3f &A, const Eigen::Vector3f &B, const Eigen::Vector3f &C);
 		static std::tuple<float, std::shared_ptr<Eigen::MatrixXf>> distanceCapsuleToSphere
-			(const Eigen::Vector3f &A, const Eigen::Vector3f &B, float radius, Eigen::VectorXf &obs);
+			(const Eigen::Vector3f &A, const Eigen::Vector3f &B, float radius, const Eigen::VectorXf &obs);
 
     private:
 		static float checkCases(const Eigen::Vector3f &A, const Eigen::Vector3f &B, Eigen::Vector4f &rec, Eigen::Vector2f &point, 
@@ -57,7 +57,7 @@ namespace base
             void checkOtherCases();
 
         public:
-            CapsuleToBox(const Eigen::Vector3f &A_, const Eigen::Vector3f &B_, float radius_, Eigen::VectorXf &obs_);
+            CapsuleToBox(const Eigen::Vector3f &A_, const Eigen::Vector3f &B_, float radius_, const Eigen::VectorXf &obs_);
 
             void compute();
             float getDistance() { return d_c; }
@@ -39,11 +39,24 @@ namespace base
 		bool isValid(const std::shared_ptr<base::State> q1, const std::shared_ptr<base::State> q2) override;
 		virtual bool isValid(const std::shared_ptr<base::State> q) override;
 		virtual float computeDistance(const std::shared_ptr<base::State> q, bool compute_again) override;
+		bool isValidAt(const std::shared_ptr<base::State> q, float t) override;
+		float computeDistanceAt(const std::shared_ptr<base::State> q, float t) override;
 		float computeDistanceUnderestimation(const std::shared_ptr<base::State> q, 
-			const std::shared_ptr<std::vector<Eigen::MatrixXf>> nearest_points) override;
+			const std::shared_ptr<base::NearestPoints> nearest_points) override;
 			
 		friend std::ostream &operator<<(std::ostream &os, const RealVectorSpace &space);
-		
+
+	protected:
+		bool isValid(const std::shared_ptr<base::State> q, const std::vector<env::ObstacleDescriptor> &obstacles,
+			const Eigen::Matrix3Xf *displacements);
+		float computeDistance(const std::shared_ptr<base::State> q, const std::vector<env::ObstacleDescriptor> &obstacles,
+			const Eigen::Matrix3Xf *displacements);
+		float computeDistanceIncrementally(const std::shared_ptr<base::State> q);
+		std::tuple<float, std::shared_ptr<Eigen::MatrixXf>> computeLinkDistance
+			(const std::shared_ptr<Eigen::MatrixXf> skeleton, size_t link_idx, const env::ObstacleDescriptor &obs);
+		std::tuple<float, std::shared_ptr<Eigen::MatrixXf>> computeLinkDistance
+			(const std::shared_ptr<Eigen::MatrixXf> skeleton, size_t link_idx, const env::ObstacleDescriptor &obs, 
+			const Eigen::Vector3f &displacement);
 	};
 }
 #endif //RPMPL_REALVECTORSPACE_H
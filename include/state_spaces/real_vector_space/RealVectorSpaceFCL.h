@@ -21,7 +21,13 @@ namespace base
 
 		std::shared_ptr<fcl::BroadPhaseCollisionManagerf> getCollisionManagerRobot() const { return collision_manager_robot; }
 		std::shared_ptr<fcl::BroadPhaseCollisionManagerf> getCollisionManagerEnv() const { return collision_manager_env; }
+		// Checks set the robot state and use shared collision managers, thus they cannot be called concurrently
+		// Note that 'isValidAt' and 'computeDistanceAt' are inherited, i.e., they use the capsule model of the robot and 
+		// the obstacle table, and not FCL objects, which are only at their current poses
+		inline bool isReentrant() const override { return false; }
 		
+		inline bool isValid(const std::shared_ptr<base::State> q1, const std::shared_ptr<base::State> q2) override 
+			{ return base::RealVectorSpace::isValid(q1, q2); }
 		bool isValid(const std::shared_ptr<base::State> q) override;
 		float computeDistance(const std::shared_ptr<base::State> q, bool compute_again) override;
 	};
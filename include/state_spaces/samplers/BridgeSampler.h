@@ -0,0 +1,30 @@
+//
+// Created by agent on 19.10.26.
+//
+
+#ifndef RPMPL_BRIDGESAMPLER_H
+#define RPMPL_BRIDGESAMPLER_H
+
+#include "Sampler.h"
+
+namespace base
+{
+	// Bridge-test sampling in narrow passages. An invalid uniform sample and an invalid Gaussian sample around it (with 'std_dev') 
+	// are taken, and their midpoint is returned if it is valid.
+	// If no such bridge is found in 'MAX_NUM_ATTEMPTS' attempts, a uniform sample is returned.
+	class BridgeSampler : public base::Sampler
+	{
+	public:
+		BridgeSampler(const std::shared_ptr<base::StateSpace> ss_, float std_dev_);
+		~BridgeSampler() {}
+
+		std::shared_ptr<base::State> sample() override;
+
+		static constexpr size_t MAX_NUM_ATTEMPTS { 100 };
+
+	private:
+		float std_dev;
+	};
+}
+
+#endif //RPMPL_BRIDGESAMPLER_H
@@ -0,0 +1,30 @@
+//
+// Created by agent on 19.10.26.
+//
+
+#ifndef RPMPL_GAUSSIANSAMPLER_H
+#define RPMPL_GAUSSIANSAMPLER_H
+
+#include "Sampler.h"
+
+namespace base
+{
+	// Gaussian sampling near obstacle boundaries. A uniform sample and a Gaussian sample around it (with 'std_dev') are taken, 
+	// and the valid one is returned only if the other one is invalid.
+	// If no such pair is found in 'MAX_NUM_ATTEMPTS' attempts, a uniform sample is returned.
+	class GaussianSampler : public base::Sampler
+	{
+	public:
+		GaussianSampler(const std::shared_ptr<base::StateSpace> ss_, float std_dev_);
+		~GaussianSampler() {}
+
+		std::shared_ptr<base::State> sample() override;
+
+		static constexpr size_t MAX_NUM_ATTEMPTS { 100 };
+
+	private:
+		float std_dev;
+	};
+}
+
+#endif //RPMPL_GAUSSIANSAMPLER_H
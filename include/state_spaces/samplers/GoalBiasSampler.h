@@ -0,0 +1,27 @@
+//
+// Created by agent on 19.10.26.
+//
+
+#ifndef RPMPL_GOALBIASSAMPLER_H
+#define RPMPL_GOALBIASSAMPLER_H
+
+#include "Sampler.h"
+
+namespace base
+{
+	// Goal state is returned with probability 'goal_bias', and otherwise a uniform sample is returned
+	class GoalBiasSampler : public base::Sampler
+	{
+	public:
+		GoalBiasSampler(const std::shared_ptr<base::StateSpace> ss_, const std::shared_ptr<base::State> q_goal_, float goal_bias_);
+		~GoalBiasSampler() {}
+
+		std::shared_ptr<base::State> sample() override;
+
+	private:
+		std::shared_ptr<base::State> q_goal;
+		float goal_bias;
+	};
+}
+
+#endif //RPMPL_GOALBIASSAMPLER_H
@@ -0,0 +1,31 @@
+//
+// Created by agent on 19.10.26.
+//
+
+#ifndef RPMPL_HALTONSAMPLER_H
+#define RPMPL_HALTONSAMPLER_H
+
+#include "Sampler.h"
+
+namespace base
+{
+	// Low-discrepancy Halton sequence within robot's joint limits, where the i-th coordinate uses the i-th prime as a base.
+	// The sequence is randomly shifted (modulo 1), so different samplers do not generate the same states.
+	class HaltonSampler : public base::Sampler
+	{
+	public:
+		HaltonSampler(const std::shared_ptr<base::StateSpace> ss_);
+		~HaltonSampler() {}
+
+		std::shared_ptr<base::State> sample() override;
+
+	private:
+		static float computeRadicalInverse(size_t idx, size_t base);
+
+		std::vector<size_t> bases;
+		Eigen::VectorXf shift;
+		size_t idx;				// Index of the next element of the sequence
+	};
+}
+
+#endif //RPMPL_HALTONSAMPLER_H
@@ -0,0 +1,38 @@
+//
+// Created by agent on 19.10.26.
+//
+
+#ifndef RPMPL_SAMPLER_H
+#define RPMPL_SAMPLER_H
+
+#include <random>
+#include <algorithm>
+
+#include "StateSpace.h"
+#include "SamplerType.h"
+
+namespace base
+{
+	// Strategy for generating random states in the whole C-space, which is shared by all planners
+	class Sampler
+	{
+	public:
+		Sampler(const std::shared_ptr<base::StateSpace> ss_);
+		virtual ~Sampler() = 0;
+
+		inline base::SamplerType getSamplerType() const { return sampler_type; }
+		virtual std::shared_ptr<base::State> sample() = 0;
+
+		static std::shared_ptr<base::Sampler> create(base::SamplerType sampler_type_, const std::shared_ptr<base::StateSpace> ss_,
+													 const std::shared_ptr<base::State> q_goal_ = nullptr);
+
+	protected:
+		Eigen::VectorXf sampleGaussian(const Eigen::VectorXf &mean, float std_dev);
+
+		base::SamplerType sampler_type;
+		std::shared_ptr<base::StateSpace> ss;
+		std::mt19937 generator;
+	};
+}
+
+#endif //RPMPL_SAMPLER_H
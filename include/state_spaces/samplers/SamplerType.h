@@ -0,0 +1,35 @@
+//
+// Created by agent on 19.10.26.
+//
+
+#ifndef RPMPL_SAMPLERTYPE_H
+#define RPMPL_SAMPLERTYPE_H
+
+#include <ostream>
+#include <string>
+#include <unordered_map>
+
+namespace base
+{
+	enum class SamplerType
+	{
+		Uniform,
+		GoalBias,
+		Gaussian,
+		Bridge,
+		Halton
+	};
+
+	static std::unordered_map<std::string, base::SamplerType> sampler_type_map = 
+	{
+		{ "Uniform", base::SamplerType::Uniform },
+		{ "GoalBias", base::SamplerType::GoalBias },
+		{ "Gaussian", base::SamplerType::Gaussian },
+		{ "Bridge", base::SamplerType::Bridge },
+		{ "Halton", base::SamplerType::Halton }
+	};
+
+	std::ostream &operator<<(std::ostream &os, const base::SamplerType &type);
+}
+
+#endif //RPMPL_SAMPLERTYPE_H
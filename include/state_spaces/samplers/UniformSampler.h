@@ -0,0 +1,23 @@
+//
+// Created by agent on 19.10.26.
+//
+
+#ifndef RPMPL_UNIFORMSAMPLER_H
+#define RPMPL_UNIFORMSAMPLER_H
+
+#include "Sampler.h"
+
+namespace base
+{
+	// Uniform distribution within robot's joint limits
+	class UniformSampler : public base::Sampler
+	{
+	public:
+		UniformSampler(const std::shared_ptr<base::StateSpace> ss_);
+		~UniformSampler() {}
+
+		std::shared_ptr<base::State> sample() override;
+	};
+}
+
+#endif //RPMPL_UNIFORMSAMPLER_H
@@ -17,3 +17,10 @@ planning::RealTimeScheduling DRGBTConfig::REAL_TIME_SCHEDULING          = planni
 float DRGBTConfig::MAX_TIME_TASK1                                       = 0.020;
 float DRGBTConfig::MAX_TIME_UPDATE_CURRENT_STATE                        = 0.002;
 planning::TrajectoryInterpolation DRGBTConfig::TRAJECTORY_INTERPOLATION = planning::TrajectoryInterpolation::Spline;
+size_t DRGBTConfig::TRAJECTORY_WINDOW_SIZE                              = 1;
+bool DRGBTConfig::LOW_LATENCY                                           = false;
+int DRGBTConfig::CPU_AFFINITY                                           = -1;
+int DRGBTConfig::THREAD_PRIORITY                                        = 0;
+size_t DRGBTConfig::NUM_THREADS                                         = 1;
+bool DRGBTConfig::PATH_SIMPLIFICATION                                   = false;
+int DRGBTConfig::OBSTACLES_RANDOM_SEED                                  = 0;
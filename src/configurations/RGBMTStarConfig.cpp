@@ -7,4 +7,6 @@
 size_t RGBMTStarConfig::MAX_NUM_ITER                = 1e9;
 size_t RGBMTStarConfig::MAX_NUM_STATES              = 1e9;
 float RGBMTStarConfig::MAX_PLANNING_TIME            = 60;
-bool RGBMTStarConfig::TERMINATE_WHEN_PATH_IS_FOUND  = false;
\ No newline at end of file
+bool RGBMTStarConfig::TERMINATE_WHEN_PATH_IS_FOUND  = false;
+bool RGBMTStarConfig::INFORMED_SAMPLING           = false;
+size_t RGBMTStarConfig::NUM_THREADS                 = 1;
\ No newline at end of file
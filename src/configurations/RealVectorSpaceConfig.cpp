@@ -5,4 +5,8 @@
 #include "RealVectorSpaceConfig.h"
 
 size_t RealVectorSpaceConfig::NUM_INTERPOLATION_VALIDITY_CHECKS = 15;
-float RealVectorSpaceConfig::EQUALITY_THRESHOLD                 = 1e-4;
\ No newline at end of file
+float RealVectorSpaceConfig::EQUALITY_THRESHOLD                 = 1e-4;
+base::SamplerType RealVectorSpaceConfig::SAMPLER_TYPE         = base::SamplerType::Uniform;
+float RealVectorSpaceConfig::GOAL_BIAS                          = 0.05;
+float RealVectorSpaceConfig::SAMPLER_STD_DEV                    = 0.1;
+base::NearestNeighboursType RealVectorSpaceConfig::NEAREST_NEIGHBOURS_TYPE = base::NearestNeighboursType::KdTree;
\ No newline at end of file
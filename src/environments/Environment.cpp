@@ -71,11 +71,23 @@ env::Environment::Environment(const std::string &config_file_path, const std::st
     {
         std::cout << e.what() << "\n";
     }
+
+    version = 0;
+    time = 0;
+    generator.seed(std::random_device{}());
+    computeObstacleTable();
 }
 
 env::Environment::~Environment()
 {
     objects.clear();
+    obstacle_table.clear();
+}
+
+void env::Environment::setTableIncluded(bool table_included_)
+{
+    table_included = table_included_;
+    computeObstacleTable();
 }
 
 void env::Environment::addObject(const std::shared_ptr<env::Object> object, const fcl::Vector3f &velocity, 
@@ -84,12 +96,19 @@ void env::Environment::addObject(const std::shared_ptr<env::Object> object, cons
     object->setVelocity(velocity);
     object->setAcceleration(acceleration);
     objects.emplace_back(object);
+    obstacle_table.emplace_back();
+    computeObstacleDescriptor(objects.size() - 1);
+    initDynamicObstacles();
+    table_version = ++version;
 }
 
 // Remove object at 'idx' position
 void env::Environment::removeObject(size_t idx)
 {
     objects.erase(objects.begin() + idx);
+    obstacle_table.erase(obstacle_table.begin() + idx);
+    initDynamicObstacles();
+    table_version = ++version;
 }
 
 // Remove objects from 'start_idx'-th object to 'end_idx'-th object
@@ -101,6 +120,8 @@ void env::Environment::removeObjects(int start_idx, int end_idx)
     
     for (int idx = end_idx; idx >= start_idx; idx--)
         objects.erase(objects.begin() + idx);
+
+    computeObstacleTable();
 }
 
 // Remove objects with label 'label' if 'with_label' is true (default)
@@ -122,13 +143,55 @@ void env::Environment::removeObjects(const std::string &label, bool with_label)
             if (objects[idx]->getLabel() != label)
                 objects.erase(objects.begin() + idx);
         }
-    }        
+    }
+
+    computeObstacleTable();
 }
 
 // Remove all objects from the environment
 void env::Environment::removeAllObjects()
 {
     objects.clear();
+    computeObstacleTable();
+}
+
+// Compute descriptors of all objects from scratch
+void env::Environment::computeObstacleTable()
+{
+    obstacle_table.resize(objects.size());
+    for (size_t idx = 0; idx < objects.size(); idx++)
+        computeObstacleDescriptor(idx);
+    
+    initDynamicObstacles();
+    table_version = ++version;
+}
+
+// Compute the descriptor of 'idx'-th object from its collision object
+void env::Environment::computeObstacleDescriptor(size_t idx)
+{
+    env::ObstacleDescriptor &obstacle { obstacle_table[idx] };
+    std::shared_ptr<fcl::CollisionObjectf> coll_object { objects[idx]->getCollObject() };
+    obstacle.type = coll_object->getNodeType();
+    obstacle.ignored_links = 0;
+    obstacle.max_vel = objects[idx]->getMaxVel();
+    obstacle.time_updated = time;
+
+    if (obstacle.type == fcl::NODE_TYPE::GEOM_BOX)
+    {
+        const fcl::AABBf &AABB { coll_object->getAABB() };
+        obstacle.bounds.resize(6);
+        obstacle.bounds << AABB.min_, AABB.max_;
+    }
+    else if (obstacle.type == fcl::NODE_TYPE::GEOM_SPHERE)
+    {
+        obstacle.bounds.resize(4);
+        obstacle.bounds << coll_object->getTranslation(), 
+                           static_cast<const fcl::Spheref*>(coll_object->collisionGeometry().get())->radius;
+    }
+
+    // The first two links are mounted on the table, so they are never checked against it
+    if (table_included && objects[idx]->getLabel() == "table")
+        obstacle.ignored_links = 0b11;
 }
 
 // Check whether an object position 'pos' is valid when the object moves at 'vel' velocity
@@ -154,59 +217,175 @@ bool env::Environment::isValid(const Eigen::Vector3f &pos, float vel)
     return true;
 }
 
-// void env::Environment::updateEnvironment(float delta_time)
-// {
-//     fcl::Vector3f pos;
-//     for (size_t i = 0; i < objects.size(); i++)
-//     {
-//         pos = objects[i]->getPosition();
-//         pos(0) -= delta_time * objects[i]->getMaxVel();    // Move along x-axis
-//         objects[i]->setPosition(pos);
-//         std::cout << i << ". " << objects[i];
-//     }
-// }
+// Initialize the store of dynamic obstacles from the corresponding objects
+void env::Environment::initDynamicObstacles()
+{
+    dynamic_obstacles.clear();
+    for (size_t idx = 0; idx < objects.size(); idx++)
+    {
+        if (objects[idx]->getLabel() == "dynamic_obstacle")
+            dynamic_obstacles.emplace_back(idx);
+    }
+
+    size_t num_dynamic_obstacles { dynamic_obstacles.size() };
+    positions.resize(3, num_dynamic_obstacles);
+    velocities.resize(3, num_dynamic_obstacles);
+    accelerations.resize(3, num_dynamic_obstacles);
+    positions_new.resize(3, num_dynamic_obstacles);
+    velocities_new.resize(3, num_dynamic_obstacles);
+    vel_intensities.resize(num_dynamic_obstacles);
 
+    for (size_t k = 0; k < num_dynamic_obstacles; k++)
+    {
+        positions.col(k) = objects[dynamic_obstacles[k]]->getPosition();
+        velocities.col(k) = objects[dynamic_obstacles[k]]->getVelocity();
+        accelerations.col(k) = objects[dynamic_obstacles[k]]->getAcceleration();
+    }
+}
+
+// Write positions, velocities and accelerations of dynamic obstacles into the corresponding objects, 
+// and update their collision objects
+void env::Environment::synchronizeObjects()
+{
+    for (size_t k = 0; k < dynamic_obstacles.size(); k++)
+    {
+        const std::shared_ptr<env::Object> object { objects[dynamic_obstacles[k]] };
+        object->setPosition(positions.col(k));
+        object->setVelocity(velocities.col(k));
+        object->setAcceleration(accelerations.col(k));
+    }
+}
+
+// Get a random unit vector
+fcl::Vector3f env::Environment::getRandomDirection()
+{
+    std::uniform_real_distribution<float> distribution(-1, 1);
+    fcl::Vector3f dir {};
+    do
+        dir << distribution(generator), distribution(generator), distribution(generator);
+    while (dir.squaredNorm() < 1e-6);
+
+    return dir.normalized();
+}
+
+// Move all dynamic obstacles for 'delta_time' using their velocities and accelerations. 
+// The motion of all obstacles is integrated at once, while only obstacles with invalid motion are treated separately.
+// Objects and their collision objects are updated at the end, so that they can be read concurrently until the next update.
 void env::Environment::updateEnvironment(float delta_time)
 {
-    float vel_intensity;
-    fcl::Vector3f pos, vel;
+    time += delta_time;
+    if (dynamic_obstacles.empty())
+        return;
 
-    for (size_t i = 0; i < objects.size(); i++)
+    velocities_new.noalias() = velocities + accelerations * delta_time;
+    positions_new.noalias() = positions + velocities_new * delta_time;
+    vel_intensities.noalias() = velocities_new.colwise().norm();
+
+    bool updated { false };
+    for (size_t k = 0; k < dynamic_obstacles.size(); k++)
     {
-        // std::cout << objects[i];
-        if (objects[i]->getLabel() != "dynamic_obstacle")
+        env::ObstacleDescriptor &obstacle { obstacle_table[dynamic_obstacles[k]] };
+        if (vel_intensities(k) > obstacle.max_vel || !isValid(positions_new.col(k), vel_intensities(k)))
+            computeValidMotion(k, delta_time);
+        
+        const fcl::Vector3f delta_pos { positions_new.col(k) - positions.col(k) };
+        if (delta_pos.isZero(0))
             continue;
+        
+        if (obstacle.type == fcl::NODE_TYPE::GEOM_BOX)
+        {
+            obstacle.bounds.head(3) += delta_pos;
+            obstacle.bounds.tail(3) += delta_pos;
+        }
+        else if (obstacle.type == fcl::NODE_TYPE::GEOM_SPHERE)
+            obstacle.bounds.head(3) += delta_pos;
+        
+        obstacle.time_updated = time;
+        updated = true;
+    }
 
-        vel = objects[i]->getVelocity() + objects[i]->getAcceleration() * delta_time;
-        pos = objects[i]->getPosition() + vel * delta_time;
+    positions.swap(positions_new);
+    velocities.swap(velocities_new);
+    synchronizeObjects();
+    
+    if (updated)
+        version++;
+}
+
+// Compute a valid motion of 'k'-th dynamic obstacle for 'delta_time' by changing the direction of its acceleration 
+// (when its maximal velocity is exceeded), or the direction of its velocity (when its new position is not valid).
+// If a valid motion is not found after 'MAX_NUM_MOTION_ATTEMPTS' attempts, the obstacle stops at its current position.
+void env::Environment::computeValidMotion(size_t k, float delta_time)
+{
+    const float max_vel { obstacle_table[dynamic_obstacles[k]].max_vel };
+    float vel_intensity { 0 };
+    fcl::Vector3f pos {}, vel {};
+
+    for (size_t num = 0; num < MAX_NUM_MOTION_ATTEMPTS; num++)
+    {
+        vel = velocities.col(k) + accelerations.col(k) * delta_time;
+        pos = positions.col(k) + vel * delta_time;
         vel_intensity = vel.norm();
-        // std::cout << i << ". position: " << pos.transpose() << "\n";
-        // std::cout << i << ". vel_intensity: " << vel_intensity << "\n";
 
-        if (vel_intensity > objects[i]->getMaxVel())
-        {
-            // std::cout << i << ". Invalid object velocity. Computing new acceleration.\n";
-            fcl::Vector3f acc = fcl::Vector3f::Random(3);
-            acc.normalize();
-            objects[i]->setAcceleration(objects[i]->getAcceleration().norm() * acc);
-            i--;
-        }
+        if (vel_intensity > max_vel)
+            accelerations.col(k) = accelerations.col(k).norm() * getRandomDirection();
         else if (!isValid(pos, vel_intensity))
-        {
-            // std::cout << i << ". position: " << pos.transpose() << "\n";
-            // std::cout << i << ". Invalid object position. Computing new velocity.\n";
-            vel = fcl::Vector3f::Random(3);
-            vel.normalize();
-            objects[i]->setVelocity(vel_intensity * vel);
-            i--;
-        }
+            velocities.col(k) = vel_intensity * getRandomDirection();
         else
         {
-            objects[i]->setVelocity(vel);
-            objects[i]->setPosition(pos);
-            // std::cout << i << ". position successfully computed: " << pos.transpose() << "\n";
-            // std::cout << i << ". " << objects[i];
+            velocities_new.col(k) = vel;
+            positions_new.col(k) = pos;
+            return;
         }
     }
-    // std::cout << "-------------------------------------------------" << std::endl;
+
+    velocities_new.col(k).setZero();
+    positions_new.col(k) = positions.col(k);
+}
+
+// Predict positions of all objects after 't' seconds from now, assuming that dynamic obstacles keep their current accelerations 
+// until their maximal velocities are reached. Return a matrix where j-th column is the predicted position of 'objects[j]'.
+// The environment is not changed.
+std::shared_ptr<Eigen::Matrix3Xf> env::Environment::predictPositions(float t)
+{
+    std::shared_ptr<Eigen::Matrix3Xf> predicted_positions { std::make_shared<Eigen::Matrix3Xf>(3, objects.size()) };
+    for (size_t idx = 0; idx < objects.size(); idx++)
+        predicted_positions->col(idx) = objects[idx]->getPosition();
+    
+    for (size_t k = 0; k < dynamic_obstacles.size(); k++)
+        predicted_positions->col(dynamic_obstacles[k]) = positions.col(k) + predictDisplacement(k, t);
+
+    return predicted_positions;
+}
+
+// Predict displacements of all objects after 't' seconds from now, where j-th column of 'displacements' corresponds to 'objects[j]',
+// and static objects have zero displacements. The environment is not changed, and 'displacements' is resized only when 
+// the number of objects changes, so it can be reused by the caller for all predictions.
+void env::Environment::predictDisplacements(float t, Eigen::Matrix3Xf &displacements) const
+{
+    displacements.resize(3, objects.size());
+    displacements.setZero();
+    for (size_t k = 0; k < dynamic_obstacles.size(); k++)
+        displacements.col(dynamic_obstacles[k]) = predictDisplacement(k, t);
+}
+
+// Predict a displacement of 'k'-th dynamic obstacle after 't' seconds from now.
+// The obstacle accelerates until its maximal velocity is reached, and then continues with a constant velocity.
+fcl::Vector3f env::Environment::predictDisplacement(size_t k, float t) const
+{
+    const fcl::Vector3f vel { velocities.col(k) };
+    const fcl::Vector3f acc { accelerations.col(k) };
+    const float max_vel { obstacle_table[dynamic_obstacles[k]].max_vel };
+    float t_acc { t };      // Time of accelerating
+
+    if (!acc.isZero(0) && (vel + acc * t).norm() > max_vel)
+    {
+        // Solve |vel + acc * t_acc| = max_vel
+        float a { acc.squaredNorm() };
+        float b { vel.dot(acc) };
+        float c { vel.squaredNorm() - max_vel * max_vel };
+        t_acc = std::clamp((-b + std::sqrt(std::max(b * b - a * c, 0.f))) / a, 0.f, t);
+    }
+
+    return vel * t_acc + 0.5 * acc * t_acc * t_acc + (vel + acc * t_acc) * (t - t_acc);
 }
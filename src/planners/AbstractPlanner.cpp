@@ -3,6 +3,7 @@
 //
 
 #include "AbstractPlanner.h"
+#include "RealVectorSpaceConfig.h"
 
 planning::AbstractPlanner::AbstractPlanner(std::shared_ptr<base::StateSpace> ss_)
 {
@@ -10,6 +11,7 @@ planning::AbstractPlanner::AbstractPlanner(std::shared_ptr<base::StateSpace> ss_
     ss = ss_;
     q_start = nullptr;
     q_goal = nullptr;
+    sampler = base::Sampler::create(RealVectorSpaceConfig::SAMPLER_TYPE, ss);
     planner_info = std::make_shared<PlannerInfo>();
 }
 
@@ -20,6 +22,7 @@ planning::AbstractPlanner::AbstractPlanner(const std::shared_ptr<base::StateSpac
     ss = ss_;
     q_start = q_start_;
     q_goal = q_goal_;
+    sampler = base::Sampler::create(RealVectorSpaceConfig::SAMPLER_TYPE, ss, q_goal);
     planner_info = std::make_shared<PlannerInfo>();
 }
 
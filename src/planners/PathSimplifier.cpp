@@ -0,0 +1,206 @@
+//
+// Created by agent on 19.10.26.
+//
+
+#include "PathSimplifier.h"
+
+planning::PathSimplifier::PathSimplifier(const std::shared_ptr<base::StateSpace> ss_,
+										 const std::shared_ptr<planning::WorkerPool> worker_pool_)
+{
+	ss = ss_;
+	worker_pool = worker_pool_;
+	num_workers = ss->isReentrant() ? worker_pool->getNumWorkers() : 1;
+	generator.seed(std::random_device{}());
+}
+
+// Return a simplified 'path', which is computed in approximately at most 'max_time' [s]
+std::vector<std::shared_ptr<base::State>> planning::PathSimplifier::simplify
+	(const std::vector<std::shared_ptr<base::State>> &path, float max_time)
+{
+	if (path.size() < 3)
+		return path;
+
+	time_start = std::chrono::steady_clock::now();
+
+	// Bubbles of path states are computed before the parallel checks (usually, they are already stored on the states)
+	for (const std::shared_ptr<base::State> &q : path)
+		ss->computeDistance(q);
+
+	checked_edges.clear();
+	std::vector<std::shared_ptr<base::State>> path_new { skipVertices(path, max_time) };
+	for (size_t num_rounds = 0; num_rounds < MAX_NUM_ROUNDS && path_new.size() > 2 && getElapsedTime() < max_time; num_rounds++)
+		shortcut(path_new);
+
+	checked_edges.clear();
+	return path_new;
+}
+
+// Greedily connect each state to the farthest following state, such that the connecting edge is valid.
+// Following states are checked in batches, where each batch contains one state per worker.
+// When 'max_time' [s] is exceeded, the remaining part of 'path' is kept as it is.
+std::vector<std::shared_ptr<base::State>> planning::PathSimplifier::skipVertices
+	(const std::vector<std::shared_ptr<base::State>> &path, float max_time)
+{
+	const size_t batch_size { num_workers };
+	std::vector<std::shared_ptr<base::State>> path_new { path.front() };
+	std::vector<std::pair<std::shared_ptr<base::State>, std::shared_ptr<base::State>>> edges {};
+	std::vector<char> valid {};
+	size_t i { 0 };
+
+	while (i + 1 < path.size() && getElapsedTime() < max_time)
+	{
+		size_t j_max { i + 1 };		// The edge to the next state is valid, since it is from the original path
+		bool is_valid { true };
+		while (is_valid && j_max + 1 < path.size() && getElapsedTime() < max_time)
+		{
+			edges.clear();
+			for (size_t j = j_max + 1; j < std::min(j_max + 1 + batch_size, path.size()); j++)
+				edges.emplace_back(path[i], path[j]);
+
+			checkEdges(edges, valid);
+			for (size_t k = 0; k < edges.size() && is_valid; k++)
+			{
+				if (valid[k])
+					j_max++;
+				else
+					is_valid = false;
+			}
+		}
+		path_new.emplace_back(path[j_max]);
+		i = j_max;
+	}
+
+	path_new.insert(path_new.end(), path.begin() + i + 1, path.end());
+	return path_new;
+}
+
+// Attempt a random shortcut per worker, and apply the valid one which decreases the path cost the most.
+// A shortcut connects a random state from some edge of the path with a random state from some following edge.
+// Each of these states is, with probability 0.5, just the corresponding edge endpoint, so the result can be memoized.
+// Return whether the path is shortened
+bool planning::PathSimplifier::shortcut(std::vector<std::shared_ptr<base::State>> &path)
+{
+	std::uniform_int_distribution<size_t> distribution_edge(0, path.size() - 2);
+	std::uniform_real_distribution<float> distribution(0, 1);
+	std::vector<std::pair<std::shared_ptr<base::State>, std::shared_ptr<base::State>>> edges {};
+	std::vector<std::pair<size_t, size_t>> edge_indices {};
+	std::vector<float> cost_decreases {};
+	std::vector<char> valid {};
+
+	for (size_t num = 0; num < num_workers; num++)
+	{
+		size_t a { distribution_edge(generator) };
+		size_t b { distribution_edge(generator) };
+		if (a > b)
+			std::swap(a, b);
+		else if (a == b)
+			continue;
+
+		// 'q1' is from the edge ('path[a]', 'path[a+1]'), and 'q2' is from the edge ('path[b+1]', 'path[b]')
+		float dist1 { ss->getNorm(path[a], path[a+1]) };
+		float dist2 { ss->getNorm(path[b+1], path[b]) };
+		std::shared_ptr<base::State> q1 { (distribution(generator) < 0.5) ? path[a] :
+			ss->interpolateEdge(path[a], path[a+1], distribution(generator) * dist1, dist1) };
+		std::shared_ptr<base::State> q2 { (distribution(generator) < 0.5) ? path[b+1] :
+			ss->interpolateEdge(path[b+1], path[b], distribution(generator) * dist2, dist2) };
+
+		float cost_old { ss->getNorm(q1, path[a+1]) + ss->getNorm(path[b], q2) };
+		for (size_t k = a + 1; k < b; k++)
+			cost_old += ss->getNorm(path[k], path[k+1]);
+
+		float cost_decrease { cost_old - ss->getNorm(q1, q2) };
+		if (cost_decrease < MIN_COST_DECREASE)
+			continue;
+
+		edges.emplace_back(q1, q2);
+		edge_indices.emplace_back(a, b);
+		cost_decreases.emplace_back(cost_decrease);
+	}
+
+	if (edges.empty())
+		return false;
+
+	checkEdges(edges, valid);
+	size_t best { edges.size() };
+	for (size_t k = 0; k < edges.size(); k++)
+	{
+		if (valid[k] && (best == edges.size() || cost_decreases[k] > cost_decreases[best]))
+			best = k;
+	}
+
+	if (best == edges.size())
+		return false;
+
+	const auto [a, b] { edge_indices[best] };
+	const auto &[q1, q2] { edges[best] };
+	std::vector<std::shared_ptr<base::State>> path_new(path.begin(), path.begin() + a + 1);
+	if (q1 != path[a])
+		path_new.emplace_back(q1);
+	if (q2 != path[b+1])
+		path_new.emplace_back(q2);
+
+	path_new.insert(path_new.end(), path.begin() + b + 1, path.end());
+	path = std::move(path_new);
+	return true;
+}
+
+// Check the validity of the edge from 'q1' to 'q2', whose distances-to-obstacles are already computed.
+// The parts of the edge covered by the bubbles of 'q1' and 'q2' are surely valid, so only the remaining part is checked
+bool planning::PathSimplifier::checkEdge(const std::shared_ptr<base::State> q1, const std::shared_ptr<base::State> q2)
+{
+	if (q1->getDistance() <= 0 || q2->getDistance() <= 0)
+		return false;
+
+	float step1 { ss->robot->computeStep(q1, q2, q1->getDistance(), 0, ss->robot->computeSkeleton(q1)) };
+	if (step1 >= 1)
+		return true;
+
+	float step2 { ss->robot->computeStep(q2, q1, q2->getDistance(), 0, ss->robot->computeSkeleton(q2)) };
+	if (step1 + step2 >= 1)
+		return true;
+
+	float dist { ss->getNorm(q1, q2) };
+	return ss->isValid(ss->interpolateEdge(q1, q2, step1 * dist, dist), ss->interpolateEdge(q2, q1, step2 * dist, dist));
+}
+
+// Check the validity of all 'edges', and store the results in 'valid'.
+// Memoized edges are not checked again, while the others are checked in parallel.
+void planning::PathSimplifier::checkEdges
+	(const std::vector<std::pair<std::shared_ptr<base::State>, std::shared_ptr<base::State>>> &edges, std::vector<char> &valid)
+{
+	valid.assign(edges.size(), false);
+	std::vector<size_t> unknown {};
+	for (size_t k = 0; k < edges.size(); k++)
+	{
+		auto it { checked_edges.find(edges[k]) };
+		if (it != checked_edges.end())
+			valid[k] = it->second;
+		else
+			unknown.emplace_back(k);
+	}
+
+	if (unknown.empty())
+		return;
+
+	std::atomic<size_t> next_idx { 0 };
+	auto checkUnknownEdges = [&]([[maybe_unused]] size_t worker_idx)
+	{
+		for (size_t i = next_idx++; i < unknown.size(); i = next_idx++)
+		{
+			const auto &[q1, q2] { edges[unknown[i]] };
+			valid[unknown[i]] = ss->computeDistance(q1) > 0 && ss->computeDistance(q2) > 0 && checkEdge(q1, q2);
+		}
+	};
+	if (num_workers > 1)
+		worker_pool->run(checkUnknownEdges);
+	else
+		checkUnknownEdges(0);
+
+	for (size_t k : unknown)
+		checked_edges.emplace(edges[k], valid[k]);
+}
+
+float planning::PathSimplifier::getElapsedTime() const
+{
+	return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - time_start).count() * 1e-6;
+}
@@ -34,6 +34,16 @@ void PlannerInfo::addRoutineTime(float time, size_t idx)
 	for (size_t i = routine_times.size(); i <= idx; i++)
 		routine_times.emplace_back(std::vector<float>());
 	routine_times[idx].emplace_back(time);
+	updateRoutineWCET(time, idx);
+}
+
+// Only the worst-case execution time is updated, thus no allocation occurs after the routine 'idx' is added for the first time
+void PlannerInfo::updateRoutineWCET(float time, size_t idx)
+{
+	if (idx >= routine_wcets.size())
+		routine_wcets.resize(idx + 1, 0);
+	
+	routine_wcets[idx] = std::max(routine_wcets[idx], time);
 }
 
 void PlannerInfo::clearPlannerInfo()
@@ -42,6 +52,8 @@ void PlannerInfo::clearPlannerInfo()
 	state_times.clear();
 	cost_convergence.clear();
 	routine_times.clear();
+	routine_wcets.clear();
+	iteration_wcet = 0;
 	planning_time = 0;
 	num_collision_queries = 0;
 	num_distance_queries = 0;
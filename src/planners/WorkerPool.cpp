@@ -0,0 +1,90 @@
+//
+// Created by agent on 19.10.26.
+//
+
+#include "WorkerPool.h"
+
+planning::WorkerPool::WorkerPool(size_t num_workers_)
+{
+	num_workers = std::max(num_workers_, size_t(1));
+	job_ptr = nullptr;
+	job_caller = nullptr;
+	job_id = 0;
+	num_busy = 0;
+	stop = false;
+
+	threads.reserve(num_workers - 1);
+	for (size_t i = 1; i < num_workers; i++)
+		threads.emplace_back(&planning::WorkerPool::work, this, i);
+}
+
+planning::WorkerPool::~WorkerPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		stop = true;
+	}
+	cv_start.notify_all();
+
+	for (std::thread &thread : threads)
+		thread.join();
+}
+
+void planning::WorkerPool::runJob()
+{
+	if (threads.empty())
+	{
+		job_caller(job_ptr, 0);
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		num_busy = threads.size();
+		job_id++;
+	}
+	cv_start.notify_all();
+
+	job_caller(job_ptr, 0);
+
+	std::unique_lock<std::mutex> lock(mutex);
+	cv_done.wait(lock, [this] { return num_busy == 0; });
+}
+
+// Set the real-time (SCHED_FIFO) 'priority' to all worker threads. Return whether it is successfully set.
+bool planning::WorkerPool::setPriority(int priority)
+{
+	sched_param param {};
+	param.sched_priority = priority;
+	bool success { true };
+	for (std::thread &thread : threads)
+	{
+		if (pthread_setschedparam(thread.native_handle(), SCHED_FIFO, &param) != 0)
+			success = false;
+	}
+	return success;
+}
+
+void planning::WorkerPool::work(size_t worker_idx)
+{
+	size_t last_job_id { 0 };
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			cv_start.wait(lock, [this, last_job_id] { return stop || job_id != last_job_id; });
+			if (stop)
+				return;
+
+			last_job_id = job_id;
+		}
+
+		job_caller(job_ptr, worker_idx); 	// The job is not changed until all workers finish it
+
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			num_busy--;
+		}
+		cv_done.notify_one();
+	}
+}
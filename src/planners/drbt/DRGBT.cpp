@@ -4,6 +4,8 @@
 
 #include "DRGBT.h"
 
+#include <cassert>
+
 // #include <glog/log_severity.h>
 // #include <glog/logging.h>
 // WARNING: You need to be very careful with LOG(INFO) for console output, due to a possible "stack smashing detected" error.
@@ -12,6 +14,9 @@
 planning::drbt::DRGBT::DRGBT(const std::shared_ptr<base::StateSpace> ss_) : RGBTConnect(ss_) 
 {
     planner_type = planning::PlannerType::DRGBT;
+    worker_pool = std::make_shared<planning::WorkerPool>(ss->isReentrant() ? DRGBTConfig::NUM_THREADS : 1);
+    path_simplifier = std::make_shared<planning::PathSimplifier>(ss, worker_pool);
+    reach_time_avg = 0;
 }
 
 planning::drbt::DRGBT::DRGBT(const std::shared_ptr<base::StateSpace> ss_, const std::shared_ptr<base::State> q_start_,
@@ -27,11 +32,15 @@ planning::drbt::DRGBT::DRGBT(const std::shared_ptr<base::StateSpace> ss_, const
     q_current = q_start;
     q_previous = q_current;
     q_target = q_current;
-    q_next = std::make_shared<planning::drbt::HorizonState>(q_current, 0);
+
+    num_lateral_states = 2 * ss->num_dimensions - 2;
+    size_t max_num_horizon_states { DRGBTConfig::INIT_HORIZON_SIZE * ss->num_dimensions + num_lateral_states };
+    horizon.reserve(max_num_horizon_states);
+    horizon_state_pool = std::make_shared<planning::drbt::HorizonStatePool>(ss, max_num_horizon_states + 3);  // + 'q_next', 'q_next_previous' and a modified state
+    q_next = horizon_state_pool->acquire(q_current, 0);
     q_next_previous = q_next;
 
     d_max_mean = 0;
-    num_lateral_states = 2 * ss->num_dimensions - 2;
     horizon_size = DRGBTConfig::INIT_HORIZON_SIZE + num_lateral_states;
     replanning = false;
     status = base::State::Status::Reached;
@@ -44,8 +53,40 @@ planning::drbt::DRGBT::DRGBT(const std::shared_ptr<base::StateSpace> ss_, const
         delta_q_max += std::pow(ss->robot->getMaxVel(i), 2);
     delta_q_max = std::sqrt(delta_q_max) * DRGBTConfig::MAX_ITER_TIME;
 
-    spline_current = std::make_shared<planning::trajectory::Spline5>(ss->robot, q_current->getCoord());
+    braking_table = std::make_shared<planning::trajectory::BrakingTable>(ss->robot);
+    spline_pool = std::make_shared<planning::trajectory::SplinePool>(ss->robot, braking_table, 3);   // 'spline_current', 'spline_next' and a new spline
+    spline_current = spline_pool->acquireSpline5(q_current->getCoord(), Eigen::VectorXf::Zero(ss->num_dimensions), 
+                                                 Eigen::VectorXf::Zero(ss->num_dimensions));
     spline_next = spline_current;
+    worker_pool = std::make_shared<planning::WorkerPool>(ss->isReentrant() ? DRGBTConfig::NUM_THREADS : 1);
+    path_simplifier = std::make_shared<planning::PathSimplifier>(ss, worker_pool);
+    reach_time_avg = 0;
+    if (DRGBTConfig::OBSTACLES_RANDOM_SEED >= 0)
+        ss->env->setRandomSeed(DRGBTConfig::OBSTACLES_RANDOM_SEED);
+
+    limits_lower.resize(ss->num_dimensions);
+    limits_upper.resize(ss->num_dimensions);
+    for (size_t i = 0; i < ss->num_dimensions; i++)
+    {
+        limits_lower(i) = ss->robot->getLimits()[i].first;
+        limits_upper(i) = ss->robot->getLimits()[i].second;
+    }
+    coord_new.resize(ss->num_dimensions);
+    coord_rand.resize(ss->num_dimensions);
+    coord_pruned.resize(ss->num_dimensions);
+    coord_spline.resize(ss->num_dimensions);
+    vel_spline.resize(ss->num_dimensions);
+    acc_spline.resize(ss->num_dimensions);
+    robot_max_vel.resize(ss->num_dimensions);
+    for (size_t i = 0; i < ss->num_dimensions; i++)
+        robot_max_vel(i) = ss->robot->getMaxVel(i);
+    
+    q_check = ss->getNewState(q_current->getCoord());
+    q_check_max_vel = ss->getNewState(q_current->getCoord());
+    processing_order.reserve(horizon_state_pool->getCapacity());
+    reach_times.reserve(horizon_state_pool->getCapacity());
+    states_to_modify.reserve(horizon_state_pool->getCapacity());
+    visited_states.reserve(horizon_state_pool->getCapacity());
 	// std::cout << "DRGBT planner initialized! \n";
 }
 
@@ -58,6 +99,9 @@ planning::drbt::DRGBT::~DRGBT()
 
 bool planning::drbt::DRGBT::solve()
 {
+    if (DRGBTConfig::LOW_LATENCY)
+        setRealTimeAttributes();
+
     time_alg_start = std::chrono::steady_clock::now();     // Start the algorithm clock
     time_iter_start = time_alg_start;
     float d_c { 0 };
@@ -67,7 +111,7 @@ bool planning::drbt::DRGBT::solve()
     // std::cout << "Obtaining the inital path... \n";
     replan(DRGBTConfig::MAX_ITER_TIME);
     planner_info->setNumIterations(planner_info->getNumIterations() + 1);
-    planner_info->addIterationTime(getElapsedTime(time_iter_start));
+    addIterationTime();
     // std::cout << "----------------------------------------------------------------------------------------\n";
 
     while (true)
@@ -77,19 +121,27 @@ bool planning::drbt::DRGBT::solve()
         time_iter_start = std::chrono::steady_clock::now();     // Start the iteration clock
         
         // ------------------------------------------------------------------------------- //
-        // Since the environment may change, a new distance is required!
+        // Since the environment may change, a new distance is required! It is recomputed only if the environment version is changed.
         auto time_computeDistance { std::chrono::steady_clock::now() };
-        d_c = ss->computeDistance(q_target, true);     // ~ 1 [ms]
+        d_c = ss->computeDistance(q_target);     // ~ 1 [ms]
         if (d_c <= 0)   // The desired/target conf. is not safe, thus the robot is required to stop immediately, 
         {               // and compute the horizon again from 'q_current'
-            // TODO: Urgently stopping needs to be implemented using quartic spline.
-            q_target = q_current;
-            d_c = ss->computeDistance(q_target, true);     // ~ 1 [ms]
+            if (DRGBTConfig::TRAJECTORY_INTERPOLATION == planning::TrajectoryInterpolation::Spline)
+            {
+                // The robot brakes from its state at the end of the previous iteration, and stops as fast as possible
+                spline_next = computeEmergencyStop(spline_next, spline_next->getTimeEnd());
+                spline_next->setTimeEnd(0);
+                spline_next->getPosition(INFINITY, coord_spline);
+                q_target = ss->getNewState(coord_spline);
+            }
+            else
+                q_target = q_current;
+            d_c = ss->computeDistance(q_target);     // ~ 1 [ms]
             clearHorizon(base::State::Status::Trapped, true);
-            q_next = std::make_shared<planning::drbt::HorizonState>(q_target, 0);
+            q_next = horizon_state_pool->acquire(q_target, 0);
             // std::cout << "Not updating the robot current state since d_c < 0. \n";
         }
-        planner_info->addRoutineTime(getElapsedTime(time_computeDistance, planning::TimeUnit::us), 1);
+        addRoutineTime(getElapsedTime(time_computeDistance, planning::TimeUnit::us), 1);
 
         // ------------------------------------------------------------------------------- //
         if (status != base::State::Status::Advanced)
@@ -147,14 +199,15 @@ bool planning::drbt::DRGBT::solve()
         {
             std::cout << "Collision has been occured!!! \n";
             planner_info->setSuccessState(false);
-            planner_info->setPlanningTime(planner_info->getIterationTimes().back());
+            planner_info->setPlanningTime(DRGBTConfig::LOW_LATENCY ? getElapsedTime(time_alg_start) : 
+                                                                        planner_info->getIterationTimes().back());
             return false;
         }
 
         // ------------------------------------------------------------------------------- //
         // Planner info and terminating condition
         planner_info->setNumIterations(planner_info->getNumIterations() + 1);
-        planner_info->addIterationTime(getElapsedTime(time_alg_start));
+        addIterationTime();
         if (checkTerminatingCondition(status))
             return planner_info->getSuccessState();
 
@@ -162,6 +215,57 @@ bool planning::drbt::DRGBT::solve()
     }
 }
 
+// Set attributes of the control task which reduce its latency, i.e., lock the memory of the process (to avoid page faults), 
+// and set the thread affinity and the real-time priority (the priority is also set to worker threads, which are not pinned).
+// After the warm-up, Task 1 takes all splines from 'spline_pool', and checks all samples on splines using preallocated states. 
+// Note that this is still not a hard real-time execution, since Task 1 allocates two states per iteration ('q_current' and 
+// 'q_target', which are kept in the realized path), and the robot's skeleton and nearest points in each distance query, 
+// while replanning (Task 2) allocates its trees.
+void planning::drbt::DRGBT::setRealTimeAttributes()
+{
+#ifdef __linux__
+    if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0)
+        std::cout << "Memory of the process cannot be locked! \n";
+
+    if (DRGBTConfig::CPU_AFFINITY >= 0)
+    {
+        cpu_set_t cpu_set {};
+        CPU_ZERO(&cpu_set);
+        CPU_SET(DRGBTConfig::CPU_AFFINITY, &cpu_set);
+        if (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpu_set) != 0)
+            std::cout << "Thread affinity cannot be set to CPU " << DRGBTConfig::CPU_AFFINITY << "! \n";
+    }
+
+    if (DRGBTConfig::THREAD_PRIORITY > 0)
+    {
+        sched_param param {};
+        param.sched_priority = DRGBTConfig::THREAD_PRIORITY;
+        if (pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) != 0 || 
+            !worker_pool->setPriority(DRGBTConfig::THREAD_PRIORITY))
+            std::cout << "Real-time priority " << DRGBTConfig::THREAD_PRIORITY << " cannot be set! \n";
+    }
+#else
+    std::cout << "Real-time attributes are supported only on Linux! \n";
+#endif
+}
+
+// In the low-latency mode, only the worst-case execution time of the routine 'idx' is updated, 
+// since storing all running times would require an allocation
+void planning::drbt::DRGBT::addRoutineTime(float time, size_t idx)
+{
+    if (DRGBTConfig::LOW_LATENCY)
+        planner_info->updateRoutineWCET(time, idx);
+    else
+        planner_info->addRoutineTime(time, idx);
+}
+
+void planning::drbt::DRGBT::addIterationTime()
+{
+    planner_info->updateIterationWCET(getElapsedTime(time_iter_start));
+    if (!DRGBTConfig::LOW_LATENCY)
+        planner_info->addIterationTime(getElapsedTime(time_alg_start));
+}
+
 // Generate a horizon using predefined path (or random nodes).
 // Only states from predefined path that come after 'q_next' are remained in the horizon. Other states are deleted.
 void planning::drbt::DRGBT::generateHorizon()
@@ -197,12 +301,12 @@ void planning::drbt::DRGBT::generateHorizon()
         if (idx + num_states <= predefined_path.size())
         {
             for (size_t i = idx; i < idx + num_states; i++)
-                horizon.emplace_back(std::make_shared<planning::drbt::HorizonState>(predefined_path[i], i));
+                horizon.emplace_back(horizon_state_pool->acquire(predefined_path[i], i));
         }
         else if (idx < predefined_path.size())
         {
             for (size_t i = idx; i < predefined_path.size(); i++)
-                horizon.emplace_back(std::make_shared<planning::drbt::HorizonState>(predefined_path[i], i));
+                horizon.emplace_back(horizon_state_pool->acquire(predefined_path[i], i));
             
             horizon.back()->setStatus(planning::drbt::HorizonState::Status::Goal);
         }
@@ -220,7 +324,7 @@ void planning::drbt::DRGBT::generateHorizon()
     // for (size_t i = 0; i < horizon.size(); i++)
     //     std::cout << i << ". state:\n" << horizon[i] << "\n";
     
-    planner_info->addRoutineTime(getElapsedTime(time_generateHorizon, planning::TimeUnit::us), 3);
+    addRoutineTime(getElapsedTime(time_generateHorizon, planning::TimeUnit::us), 3);
 }
 
 // Update the horizon size, and add lateral spines.
@@ -250,57 +354,119 @@ void planning::drbt::DRGBT::updateHorizon(float d_c)
     // std::cout << "Adding " << num_lateral_states << " lateral states... \n";
     addLateralStates();
     horizon_size = horizon.size();
-    planner_info->addRoutineTime(getElapsedTime(time_updateHorizon, planning::TimeUnit::us), 4);
+    addRoutineTime(getElapsedTime(time_updateHorizon, planning::TimeUnit::us), 4);
 }
 
 // Generate the generalized bur from 'q_target', i.e., compute the horizon spines.
-// Bad and critical states will be replaced with "better" states, such that the horizon contains possibly better states.
+// Horizon states are processed in the order of their expected value (see 'computeProcessingOrder'). 
+// Spines are computed by the workers from 'worker_pool' (there is only one worker if the state space is not reentrant), 
+// until the deadline for Task 1 is reached. The deadline is checked 
+// using the running average of time needed to compute a single spine, and states that are not processed are deleted.
+// Afterwards, bad and critical states will be replaced with "better" states, such that the horizon contains possibly better states.
 void planning::drbt::DRGBT::generateGBur()
 {
     // std::cout << "Generating gbur by computing reached states... \n";
     auto time_generateGBur { std::chrono::steady_clock::now() };
-    size_t max_num_attempts { 0 };
+    const bool use_deadline { DRGBTConfig::REAL_TIME_SCHEDULING != planning::RealTimeScheduling::None };
+    const float time_deadline { DRGBTConfig::MAX_TIME_TASK1 - DRGBTConfig::MAX_TIME_UPDATE_CURRENT_STATE };
+    const size_t num_states { horizon.size() };
+    std::atomic<size_t> next_order_idx { 0 };
     planner_info->setTask1Interrupted(false);
+    computeProcessingOrder();
+    reach_times.assign(num_states, -1);     // -1 means that the state is not processed
 
-    for (size_t idx = 0; idx < horizon.size(); idx++)
-    {
-        computeReachedState(horizon[idx]);
-        // std::cout << idx << ". state:\n" << horizon[idx] << "\n";
+    // Distance-to-obstacles of 'q_target' is shared by all workers, thus it must be computed before, such that workers only read it
+    ss->computeDistance(q_target);
+    assert(q_target->getDistance() >= 0 && q_target->getIsRealDistance() && q_target->getEnvVersion() == ss->env->getVersion());
 
-        if (DRGBTConfig::REAL_TIME_SCHEDULING != planning::RealTimeScheduling::None)   // Some scheduling is chosen
+    auto computeReachedStates = [&]([[maybe_unused]] size_t worker_idx)
+    {
+        for (size_t k = next_order_idx++; k < num_states; k = next_order_idx++)
         {
-            // Check whether the elapsed time for Task 1 is exceeded
-            float time_elapsed = getElapsedTime(time_iter_start);
-            if (time_elapsed >= DRGBTConfig::MAX_TIME_TASK1 - DRGBTConfig::MAX_TIME_UPDATE_CURRENT_STATE && 
-                idx < horizon.size() - 1)
+            // At least the most valuable state is always processed
+            if (use_deadline && k > 0 && getElapsedTime(time_iter_start) + reach_time_avg >= time_deadline)
             {
-                // Delete horizon states for which there is no enough remaining time to be processed
-                // This is OK since better states are usually located at the beginning of horizon
-                for (size_t i = horizon.size() - 1; i > idx; i--)
-                {
-                    if (q_next == horizon[i])   // 'q_next' will be deleted
-                        q_next = horizon.front();
-
-                    horizon.erase(horizon.begin() + i);
-                }
-                
-                // std::cout << "Deleting " << horizon_size - horizon.size() << " of " << horizon_size << " horizon states...\n";
-                planner_info->setTask1Interrupted(true);
-                planner_info->addRoutineTime(getElapsedTime(time_generateGBur, planning::TimeUnit::ms), 2);
+                next_order_idx = num_states;
                 return;
             }
-            max_num_attempts = std::ceil((1 - time_elapsed / (DRGBTConfig::MAX_TIME_TASK1 - DRGBTConfig::MAX_TIME_UPDATE_CURRENT_STATE)) 
-                               * DRGBTConfig::MAX_NUM_MODIFY_ATTEMPTS);
+            auto time_computeReachedState { std::chrono::steady_clock::now() };
+            computeReachedState(horizon[processing_order[k]]);
+            reach_times[processing_order[k]] = getElapsedTime(time_computeReachedState);
         }
-        else
-            max_num_attempts = DRGBTConfig::MAX_NUM_MODIFY_ATTEMPTS;
+    };
+    worker_pool->run(computeReachedStates);
 
-        // Bad and critical states are modified if there is enough remaining time for Task 1
-        if (horizon[idx]->getStatus() == planning::drbt::HorizonState::Status::Bad || 
-            horizon[idx]->getStatus() == planning::drbt::HorizonState::Status::Critical)
-            modifyState(horizon[idx], max_num_attempts);
+    for (size_t idx = 0; idx < num_states; idx++)
+    {
+        if (reach_times[idx] >= 0)
+            reach_time_avg = (reach_time_avg == 0) ? reach_times[idx] : 
+                             (1 - REACH_TIME_SMOOTHING) * reach_time_avg + REACH_TIME_SMOOTHING * reach_times[idx];
     }
-    planner_info->addRoutineTime(getElapsedTime(time_generateGBur, planning::TimeUnit::ms), 2);
+
+    // Bad and critical states are modified (in the processing order) if there is enough remaining time for Task 1.
+    // The remaining time is equally shared among states that still need to be modified, and it is recomputed after each state.
+    states_to_modify.clear();
+    for (size_t idx : processing_order)
+    {
+        if (reach_times[idx] >= 0 && 
+            (horizon[idx]->getStatus() == planning::drbt::HorizonState::Status::Bad || 
+             horizon[idx]->getStatus() == planning::drbt::HorizonState::Status::Critical))
+            states_to_modify.emplace_back(idx);
+    }
+
+    size_t max_num_attempts { DRGBTConfig::MAX_NUM_MODIFY_ATTEMPTS };
+    for (size_t k = 0; k < states_to_modify.size(); k++)
+    {
+        if (use_deadline)
+        {
+            float time_remain { time_deadline - getElapsedTime(time_iter_start) };
+            if (time_remain <= reach_time_avg)
+                break;
+            
+            if (reach_time_avg > 0)
+                max_num_attempts = std::min(std::max(size_t(time_remain / (reach_time_avg * (states_to_modify.size() - k))), size_t(1)), 
+                                            DRGBTConfig::MAX_NUM_MODIFY_ATTEMPTS);
+        }
+        modifyState(horizon[states_to_modify[k]], max_num_attempts);
+    }
+
+    // Delete horizon states for which there was no enough remaining time to be processed.
+    // Note that 'q_next' is never deleted, since it is processed first.
+    for (int idx = num_states - 1; idx >= 0; idx--)
+    {
+        if (reach_times[idx] < 0)
+        {
+            horizon.erase(horizon.begin() + idx);
+            planner_info->setTask1Interrupted(true);
+        }
+    }
+    // if (planner_info->getTask1Interrupted())
+    //     std::cout << "Deleting " << num_states - horizon.size() << " of " << num_states << " horizon states...\n";
+
+    addRoutineTime(getElapsedTime(time_generateGBur, planning::TimeUnit::ms), 2);
+}
+
+// Compute the order in which horizon states are processed, such that states with a higher expected value come first:
+// 'q_next', then states from the predefined path sorted by their distance (in the path) from 'q_next', then lateral states, 
+// and finally random states sorted by their distance-to-obstacles from the previous iteration (new random states come last).
+void planning::drbt::DRGBT::computeProcessingOrder()
+{
+    auto getPriority = [this](const std::shared_ptr<planning::drbt::HorizonState> q) -> std::pair<int, float>
+    {
+        if (q == q_next)
+            return {0, 0};
+        else if (q->getIndex() != -1)
+            return {1, std::abs(q->getIndex() - q_next->getIndex())};
+        else if (q->getIsLateral())
+            return {2, 0};
+        else
+            return {3, -q->getDistance()};
+    };
+
+    processing_order.resize(horizon.size());
+    std::iota(processing_order.begin(), processing_order.end(), 0);
+    std::sort(processing_order.begin(), processing_order.end(), [&](size_t idx1, size_t idx2) 
+              { return std::make_tuple(getPriority(horizon[idx1]), idx1) < std::make_tuple(getPriority(horizon[idx2]), idx2); });
 }
 
 // Shorten the horizon by removing 'num' states. Excess states are deleted, and best states holds priority.
@@ -343,11 +509,15 @@ void planning::drbt::DRGBT::shortenHorizon(size_t num)
 
 void planning::drbt::DRGBT::addRandomStates(size_t num)
 {
-    std::shared_ptr<base::State> q_rand { nullptr };
     for (size_t i = 0; i < num; i++)
     {
-        q_rand = getRandomState(q_target);
-        horizon.emplace_back(std::make_shared<planning::drbt::HorizonState>(q_rand, -1));
+        size_t num_attempts { 0 };
+        do
+            computeRandomCoord(coord_new);
+        while (!saturateAndPrune(coord_new) && ++num_attempts < MAX_NUM_RANDOM_ATTEMPTS);
+
+        if (num_attempts < MAX_NUM_RANDOM_ATTEMPTS)
+            horizon.emplace_back(horizon_state_pool->acquire(coord_new));
         // std::cout << "Adding random state: " << horizon.back()->getCoord().transpose() << "\n";
     }
 }
@@ -357,18 +527,16 @@ void planning::drbt::DRGBT::addLateralStates()
     size_t num_added { 0 };
     if (ss->num_dimensions == 2)   // In 2D C-space only two possible lateral spines exist
     {
-        std::shared_ptr<base::State> q_new;
         Eigen::Vector2f new_vec;
         for (int coord = -1; coord <= 1; coord += 2)
         {
             new_vec(0) = -coord; 
             new_vec(1) = coord * (q_next->getCoord(0) - q_target->getCoord(0)) / (q_next->getCoord(1) - q_target->getCoord(1));
-            q_new = ss->getNewState(q_target->getCoord() + new_vec);
-            q_new = ss->interpolateEdge(q_target, q_new, RBTConnectConfig::DELTA);
-            q_new = ss->pruneEdge(q_target, q_new);
-            if (!ss->isEqual(q_target, q_new))
+            coord_new = q_target->getCoord() + new_vec;
+            if (saturateAndPrune(coord_new))
             {
-                horizon.emplace_back(std::make_shared<planning::drbt::HorizonState>(q_new, -1));
+                horizon.emplace_back(horizon_state_pool->acquire(coord_new));
+                horizon.back()->setIsLateral(true);
                 num_added++;
                 // std::cout << "Adding lateral state: " << horizon.back()->getCoord().transpose() << "\n";
             }
@@ -383,20 +551,16 @@ void planning::drbt::DRGBT::addLateralStates()
             
         if (idx < ss->num_dimensions)
         {
-            std::shared_ptr<base::State> q_new { nullptr };
-            float coord { 0 };
             for (size_t i = 0; i < num_lateral_states; i++)
             {
-                q_new = ss->getRandomState(q_target);
-                coord = q_target->getCoord(idx) + q_new->getCoord(idx) -
-                        (q_next->getCoord() - q_target->getCoord()).dot(q_new->getCoord()) /
-                        (q_next->getCoord(idx) - q_target->getCoord(idx));
-                q_new->setCoord(coord, idx);
-                q_new = ss->interpolateEdge(q_target, q_new, RBTConnectConfig::DELTA);
-                q_new = ss->pruneEdge(q_target, q_new);
-                if (!ss->isEqual(q_target, q_new))
+                computeRandomCoord(coord_new);
+                coord_new(idx) = q_target->getCoord(idx) + coord_new(idx) -
+                                 (q_next->getCoord() - q_target->getCoord()).dot(coord_new) /
+                                 (q_next->getCoord(idx) - q_target->getCoord(idx));
+                if (saturateAndPrune(coord_new))
                 {
-                    horizon.emplace_back(std::make_shared<planning::drbt::HorizonState>(q_new, -1));
+                    horizon.emplace_back(horizon_state_pool->acquire(coord_new));
+                    horizon.back()->setIsLateral(true);
                     num_added++;
                     // std::cout << "Adding lateral state: " << horizon.back()->getCoord().transpose() << "\n";
                 }
@@ -412,28 +576,26 @@ void planning::drbt::DRGBT::addLateralStates()
 bool planning::drbt::DRGBT::modifyState(std::shared_ptr<planning::drbt::HorizonState> &q, size_t max_num_attempts)
 {
     std::shared_ptr<planning::drbt::HorizonState> q_new_horizon_state { nullptr };
-    std::shared_ptr<base::State> q_new { nullptr };
     std::shared_ptr<base::State> q_reached { q->getStateReached() };
     float norm { ss->getNorm(q_target, q_reached) };
     float coeff { 0 };
     
     for (size_t num = 0; num < max_num_attempts; num++)
     {
-        Eigen::VectorXf vec = Eigen::VectorXf::Random(ss->num_dimensions) * norm / std::sqrt(ss->num_dimensions - 1);
-        vec(0) = (vec(0) > 0) ? 1 : -1;
-        vec(0) *= std::sqrt(norm * norm - vec.tail(ss->num_dimensions - 1).squaredNorm());
+        coord_rand.setRandom();
+        coord_rand *= norm / std::sqrt(ss->num_dimensions - 1);
+        coord_rand(0) = (coord_rand(0) > 0) ? 1 : -1;
+        coord_rand(0) *= std::sqrt(norm * norm - coord_rand.tail(ss->num_dimensions - 1).squaredNorm());
         if (q->getStatus() == planning::drbt::HorizonState::Status::Bad)
-            q_new = ss->getNewState(q_reached->getCoord() + vec);
+            coord_new = q_reached->getCoord() + coord_rand;
         else if (q->getStatus() == planning::drbt::HorizonState::Status::Critical)
         {
-            q_new = ss->getNewState(2 * q_target->getCoord() - q_reached->getCoord() + coeff * vec);
+            coord_new = 2 * q_target->getCoord() - q_reached->getCoord() + coeff * coord_rand;
             coeff = 1;
         }
-        q_new = ss->interpolateEdge(q_target, q_new, RBTConnectConfig::DELTA);
-        q_new = ss->pruneEdge(q_target, q_new);
-        if (!ss->isEqual(q_target, q_new))
+        if (saturateAndPrune(coord_new))
         {
-            q_new_horizon_state = std::make_shared<planning::drbt::HorizonState>(q_new, -1);
+            q_new_horizon_state = horizon_state_pool->acquire(coord_new);
             computeReachedState(q_new_horizon_state);
             if (q_new_horizon_state->getDistance() > q->getDistance())
             {
@@ -451,6 +613,46 @@ bool planning::drbt::DRGBT::modifyState(std::shared_ptr<planning::drbt::HorizonS
     return false;
 }
 
+// Compute (in-place) coordinates 'coord' of a random state with uniform distribution, which is centered around 'q_target'.
+// The same as 'ss->getRandomState(q_target)', but without allocating a new state.
+void planning::drbt::DRGBT::computeRandomCoord(Eigen::VectorXf &coord)
+{
+    coord.setRandom();
+    coord = ((limits_upper - limits_lower).cwiseProduct(coord) + limits_lower + limits_upper) / 2 + q_target->getCoord();
+}
+
+// Saturate the spine from 'q_target' towards 'coord' to the length 'RBTConnectConfig::DELTA', and prune it regarding joint limits.
+// The same as 'ss->interpolateEdge' followed by 'ss->pruneEdge', but 'coord' is modified in-place.
+// Return whether the resulting state differs from 'q_target'.
+bool planning::drbt::DRGBT::saturateAndPrune(Eigen::VectorXf &coord)
+{
+    const Eigen::VectorXf &coord_target { q_target->getCoord() };
+    float dist { (coord - coord_target).norm() };
+    if (dist > 0)
+        coord = coord_target + (coord - coord_target) * (RBTConnectConfig::DELTA / dist);
+
+    float bound { 0 };
+    for (size_t k = 0; k < ss->num_dimensions; k++)
+    {
+        if (coord(k) > limits_upper(k))
+            bound = limits_upper(k);
+        else if (coord(k) < limits_lower(k))
+            bound = limits_lower(k);
+        else
+            continue;
+        
+        coord_pruned = coord_target + (bound - coord_target(k)) / (coord(k) - coord_target(k)) * (coord - coord_target);
+        if ((coord_pruned.array() >= limits_lower.array() - RealVectorSpaceConfig::EQUALITY_THRESHOLD).all() &&
+            (coord_pruned.array() <= limits_upper.array() + RealVectorSpaceConfig::EQUALITY_THRESHOLD).all())
+        {
+            coord = coord_pruned;
+            break;
+        }
+    }
+
+    return (coord - coord_target).norm() >= RealVectorSpaceConfig::EQUALITY_THRESHOLD;
+}
+
 // Compute reached state when generating a generalized spine from 'q_target' towards 'q'.
 void planning::drbt::DRGBT::computeReachedState(const std::shared_ptr<planning::drbt::HorizonState> q)
 {
@@ -462,6 +664,18 @@ void planning::drbt::DRGBT::computeReachedState(const std::shared_ptr<planning::
 
     // TODO: If there is enough remaining time, compute real distance-to-obstacles 
     float d_c = ss->computeDistanceUnderestimation(q_reached, q_target->getNearestPoints());
+
+    // 'q_reached' is considered as critical if it will be in collision with dynamic obstacles at the time when the robot 
+    // could reach it, i.e., after reaching 'q_target' at the end of the current iteration, and moving at maximal velocity
+    if (d_c > 0 && ss->env->getNumDynamicObstacles() > 0)
+    {
+        float t_reached { 0 };
+        for (size_t i = 0; i < ss->num_dimensions; i++)
+            t_reached = std::max(t_reached, std::abs(q_reached->getCoord(i) - q_target->getCoord(i)) / ss->robot->getMaxVel(i));
+        
+        if (!ss->isValidAt(q_reached, DRGBTConfig::MAX_ITER_TIME + t_reached))
+            d_c = 0;
+    }
     if (q->getDistance() != -1)
         q->setDistancePrevious(q->getDistance());
     else
@@ -475,75 +689,67 @@ void planning::drbt::DRGBT::computeReachedState(const std::shared_ptr<planning::
 }
 
 // Compute weight for each state from the horizon, and then obtain the next state
+// All horizon data is first gathered into 'horizon_block', such that weights are computed in a vectorized manner.
 void planning::drbt::DRGBT::computeNextState()
 {
-    std::vector<float> dist_to_goal(horizon.size());
-    float d_goal_min { INFINITY };
-    size_t d_goal_min_idx { 0 };
-    float d_c_max { 0 };
+    const size_t n { horizon.size() };
+    if (horizon_block.getCapacity() < n)
+        horizon_block.reserve(std::max(n, DRGBTConfig::INIT_HORIZON_SIZE * ss->num_dimensions + num_lateral_states), ss->num_dimensions);
 
-    for (size_t i = 0; i < horizon.size(); i++)
+    for (size_t i = 0; i < n; i++)
     {
-        dist_to_goal[i] = ss->getNorm(horizon[i]->getStateReached(), q_goal);
-        if (dist_to_goal[i] < d_goal_min)
-        {
-            d_goal_min = dist_to_goal[i];
-            d_goal_min_idx = i;
-        }
-        if (horizon[i]->getDistance() > d_c_max)
-            d_c_max = horizon[i]->getDistance();
+        horizon[i]->setHandle(i);
+        horizon_block.coord_reached.col(i) = horizon[i]->getStateReached()->getCoord();
+        horizon_block.d_c(i) = horizon[i]->getDistance();
+        horizon_block.d_c_previous(i) = horizon[i]->getDistancePrevious();
+        horizon_block.index(i) = horizon[i]->getIndex();
+        horizon_block.status(i) = int(horizon[i]->getStatus());
     }
+
+    auto coord_reached { horizon_block.coord_reached.leftCols(n) };
+    auto d_c { horizon_block.d_c.head(n).array() };
+    auto d_c_previous { horizon_block.d_c_previous.head(n).array() };
+    auto weight { horizon_block.weight.head(n).array() };
+    auto dist_to_goal { horizon_block.dist_to_goal.head(n).array() };
+    auto is_critical { horizon_block.status.head(n).array() == int(planning::drbt::HorizonState::Status::Critical) };
+    
+    dist_to_goal = (coord_reached.colwise() - q_goal->getCoord()).colwise().norm().transpose().array();
+    Eigen::Index d_goal_min_idx { 0 };
+    float d_goal_min { dist_to_goal.minCoeff(&d_goal_min_idx) };
+    float d_c_max { std::max(d_c.maxCoeff(), 0.f) };
     
     if (d_goal_min < RealVectorSpaceConfig::EQUALITY_THRESHOLD) // 'q_goal' lies in the horizon
     {
         d_goal_min = RealVectorSpaceConfig::EQUALITY_THRESHOLD; // Only to avoid "0/0" when 'dist_to_goal[i] < RealVectorSpaceConfig::EQUALITY_THRESHOLD'
-        dist_to_goal[d_goal_min_idx] = d_goal_min;
+        dist_to_goal(d_goal_min_idx) = d_goal_min;
     }
-
-    std::vector<float> weights_dist(horizon.size());
-    for (size_t i = 0; i < horizon.size(); i++)
-        weights_dist[i] = d_goal_min / dist_to_goal[i];        
     
     d_max_mean = (planner_info->getNumIterations() * d_max_mean + d_c_max) / (planner_info->getNumIterations() + 1);
-    float weights_dist_mean = std::accumulate(weights_dist.begin(), weights_dist.end(), 0.0) / horizon.size();
-    float max_weight { 0 };
-    float weight { 0 };
-    int idx_best { -1 };
+    
+    // Computing 'weight' according to the following heuristic (distance weights are temporary stored in 'weight'):
+    weight = d_goal_min / dist_to_goal;
+    weight = d_c / d_max_mean + (d_c - d_c_previous) / d_max_mean + weight - weight.mean();
 
-    for (size_t i = 0; i < horizon.size(); i++)
-    {
-        if (horizon[i]->getStatus() == planning::drbt::HorizonState::Status::Critical)  // 'weight' is already set to zero
-            continue;
-        
-        // Computing 'weight' according to the following heuristic:
-        weight = horizon[i]->getDistance() / d_max_mean
-                 + (horizon[i]->getDistance() - horizon[i]->getDistancePrevious()) / d_max_mean 
-                 + weights_dist[i] - weights_dist_mean;
-        
-        // Saturate 'weight' since it must be between 0 and 1
-        if (weight > 1)
-            weight = 1;
-        else if (weight < 0)
-            weight = 0;
-
-        // If state does not belong to the predefined path, 'weight' is decreased within the range [0, DRGBTConfig::TRESHOLD_WEIGHT]
-        // If such state becomes the best one, the replanning will surely be triggered
-        if (horizon[i]->getIndex() == -1)   
-            weight *= DRGBTConfig::TRESHOLD_WEIGHT;
-        
-        horizon[i]->setWeight(weight);
+    // Saturate 'weight' since it must be between 0 and 1
+    weight = weight.max(0).min(1);
 
-        if (weight > max_weight)
-        {
-            max_weight = weight;
-            idx_best = i;
-        }
+    // If state does not belong to the predefined path, 'weight' is decreased within the range [0, DRGBTConfig::TRESHOLD_WEIGHT]
+    // If such state becomes the best one, the replanning will surely be triggered
+    weight = (horizon_block.index.head(n).array() == -1).select(weight * DRGBTConfig::TRESHOLD_WEIGHT, weight);
+    weight = is_critical.select(0, weight);     // 'weight' of critical states is already set to zero
+
+    for (size_t i = 0; i < n; i++)
+    {
+        if (!is_critical(i))
+            horizon[i]->setWeight(weight(i));
     }
 
-    if (idx_best != -1)
+    Eigen::Index idx_best { 0 };
+    float max_weight { weight.maxCoeff(&idx_best) };
+
+    if (max_weight > 0)
     {
         q_next = horizon[idx_best];
-        float d_min { dist_to_goal[idx_best] };
 
         // Do the following only if 'q_next' belongs to the predefined path
         if (q_next->getIndex() != -1)
@@ -551,14 +757,10 @@ void planning::drbt::DRGBT::computeNextState()
             float hysteresis = 0.1 * DRGBTConfig::TRESHOLD_WEIGHT;  // Hysteresis size when choosing the next state
 
             // "The best" state nearest to the goal is chosen as the next state
-            for (size_t i = 0; i < horizon.size(); i++)
-            {
-                if (std::abs(q_next->getWeight() - horizon[i]->getWeight()) < hysteresis && dist_to_goal[i] < d_min)
-                {
-                    d_min = dist_to_goal[i];
-                    q_next = horizon[i];
-                }
-            }
+            Eigen::Index idx_nearest { 0 };
+            float d_min { ((weight - max_weight).abs() < hysteresis).select(dist_to_goal, INFINITY).minCoeff(&idx_nearest) };
+            if (d_min < dist_to_goal(idx_best))
+                q_next = horizon[idx_nearest];
 
             // If weights of 'q_next_previous' and 'q_next' are close, 'q_next_previous' remains the next state
             if (q_next != q_next_previous &&
@@ -571,7 +773,7 @@ void planning::drbt::DRGBT::computeNextState()
     else    // All states are critical, and q_next cannot be updated! 'status' will surely become Trapped
     {
         // std::cout << "All states are critical, and q_next cannot be updated! \n";
-        q_next = std::make_shared<planning::drbt::HorizonState>(q_target, 0);
+        q_next = horizon_state_pool->acquire(q_target, 0);
         q_next->setStateReached(q_target);
     }
 
@@ -584,14 +786,14 @@ void planning::drbt::DRGBT::computeNextState()
 }
 
 // Return index in the horizon of state 'q'. If 'q' does not belong to the horizon, -1 is returned.
+// The handle of 'q' is used, which is valid if 'q' is still located at its position.
 int planning::drbt::DRGBT::getIndexInHorizon(const std::shared_ptr<planning::drbt::HorizonState> q)
 {
-    for (size_t idx = 0; idx < horizon.size(); idx++)
-    {
-        if (q == horizon[idx])
-            return idx;
-    }
-    return -1;   
+    int idx { q->getHandle() };
+    if (idx >= 0 && idx < int(horizon.size()) && horizon[idx] == q)
+        return idx;
+
+    return -1;
 }
 
 /// @brief Update the current state 'q_current' to become 'q_target'.
@@ -664,7 +866,8 @@ float planning::drbt::DRGBT::updateCurrentState()
     spline_current->setTimeBegin(spline_next->getTimeEnd());
     spline_current->setTimeCurrent(t_spline_current);
 
-    q_current = ss->getNewState(spline_current->getPosition(t_spline_current));
+    spline_current->getPosition(t_spline_current, coord_spline);
+    q_current = ss->getNewState(coord_spline);
 
     // std::cout << "Iter. time:        " << t_iter * 1000 << " [ms] \n";
     // std::cout << "Max. spline time:  " << t_spline_max * 1000 << " [ms] \n";
@@ -682,8 +885,31 @@ float planning::drbt::DRGBT::updateCurrentState()
         return t_spline_max;
     }
 
+    collectSplineWaypoints();
+    std::shared_ptr<planning::trajectory::CompositeSpline> composite_current
+        { std::dynamic_pointer_cast<planning::trajectory::CompositeSpline>(spline_current) };
+    auto haveSameWaypoints = [&]() -> bool
+    {
+        if (composite_current == nullptr || composite_current->getWaypoints().size() != spline_waypoints.size())
+            return false;
+        
+        for (size_t k = 0; k < spline_waypoints.size(); k++)
+        {
+            if ((composite_current->getWaypoints()[k] - spline_waypoints[k]).norm() >= RealVectorSpaceConfig::EQUALITY_THRESHOLD)
+                return false;
+        }
+        return true;
+    };
+
     bool found { false };
-    if ((q_next->getStateReached()->getCoord() - spline_current->getPosition(INFINITY)).norm() 
+    bool emergency_stop { false };
+    spline_current->getPosition(INFINITY, coord_spline);
+    if (spline_waypoints.size() > 1 && haveSameWaypoints())     // Waypoints of the composite spline did not change
+    {
+        // std::cout << "Not computing a new spline! \n";
+        found = false;
+    }
+    else if (spline_waypoints.size() == 1 && (q_next->getStateReached()->getCoord() - coord_spline).norm() 
         < RealVectorSpaceConfig::EQUALITY_THRESHOLD)  // Coordinates of q_next_reached did not change
     {
         // std::cout << "Not computing a new spline! \n";
@@ -693,21 +919,39 @@ float planning::drbt::DRGBT::updateCurrentState()
     {
         // std::cout << "Robot is urgently stopping! \n";
         found = false;
-        // TODO: Urgently stopping needs to be implemented using quartic spline.
+        if (std::dynamic_pointer_cast<planning::trajectory::Spline4>(spline_current) == nullptr)     // The robot is not already braking
+        {
+            spline_next = computeEmergencyStop(spline_current, t_spline_current);
+            found = true;
+            emergency_stop = true;
+        }
     }
     else
     {
         std::chrono::steady_clock::time_point time_start_ { std::chrono::steady_clock::now() };
-        std::vector<std::shared_ptr<planning::drbt::HorizonState>> visited_states { q_next };
-        spline_next = std::make_shared<planning::trajectory::Spline5>
-        (
-            ss->robot, 
-            q_current->getCoord(),
-            spline_current->getVelocity(t_spline_current),
-            spline_current->getAcceleration(t_spline_current)
-        );
-
-        while (getElapsedTime(time_start_) < 0.9 * t_spline_max)
+        spline_current->getVelocity(t_spline_current, vel_spline);
+        spline_current->getAcceleration(t_spline_current, acc_spline);
+        if (spline_waypoints.size() > 1)
+        {
+            // The robot passes through 'q_next' without stopping, and subsplines are reused from the current spline if possible
+            std::shared_ptr<planning::trajectory::CompositeSpline> composite_next { 
+                spline_pool->acquireCompositeSpline(q_current->getCoord(), vel_spline, acc_spline) 
+            };
+            if (composite_next->compute(spline_waypoints, composite_current))
+            {
+                // std::cout << "New composite spline is computed through " << composite_next->getNumSubsplines() << " waypoints! \n";
+                spline_next = composite_next;
+                found = true;
+            }
+        }
+
+        visited_states.clear();
+        visited_states.emplace_back(q_next);
+        if (!found)
+            spline_next = spline_pool->acquireSpline5(q_current->getCoord(), vel_spline, acc_spline);
+
+        size_t num_attempts { 0 };
+        while (!found && getElapsedTime(time_start_) < 0.9 * t_spline_max && num_attempts++ < horizon.size())
         {
             if (spline_next->compute(q_next->getStateReached()->getCoord()))
             {
@@ -722,9 +966,17 @@ float planning::drbt::DRGBT::updateCurrentState()
                 break;
             }
         }
+        visited_states.clear();     // Horizon states are released, so they can be recycled by 'horizon_state_pool'
         // std::cout << "Elapsed time for spline computing: " << getElapsedTime(time_start_, planning::TimeUnit::us) << " [us] \n";
     }
 
+    // The new spline is discarded if the robot will be in collision with obstacles at their predicted positions 
+    // at any time until reaching its target state. An emergency stop is never discarded, since falling back to 
+    // the current spline would keep the robot moving towards the obstacles.
+    if (found && !emergency_stop && !validateSpline(spline_next, 0, t_iter_remain + DRGBTConfig::MAX_TIME_TASK1, DRGBTConfig::MAX_ITER_TIME - t_iter_remain, 
+                                 t_spline_max - (getElapsedTime(time_iter_start) - t_iter)))
+        found = false;
+
     if (found)
     {
         spline_current->setTimeEnd(t_spline_current);
@@ -736,9 +988,8 @@ float planning::drbt::DRGBT::updateCurrentState()
         spline_next->setTimeEnd(t_spline_current + t_iter_remain);
     }
 
-    // TODO: New spline needs to be validated on collision, at least during the current iteration!
-    
-    q_target = ss->getNewState(spline_next->getPosition(spline_next->getTimeEnd() + DRGBTConfig::MAX_TIME_TASK1));
+    spline_next->getPosition(spline_next->getTimeEnd() + DRGBTConfig::MAX_TIME_TASK1, coord_spline);
+    q_target = ss->getNewState(coord_spline);
     // std::cout << "q_target time: " << (spline_next->getTimeEnd() + DRGBTConfig::MAX_TIME_TASK1) * 1000 << " [ms] \n";
     // std::cout << "q_target:      " << q_target << "\n";
     // std::cout << "Spline next: \n" << spline_next << "\n";
@@ -762,6 +1013,95 @@ float planning::drbt::DRGBT::updateCurrentState()
     return t_spline_max - (getElapsedTime(time_iter_start) - t_iter);
 }
 
+/// @brief Validate 'spline' on collision in the time interval ['t_begin', 't_end'] in [s], while obstacles are at their positions 
+/// predicted 'delta_time' in [s] after the spline time. Samples are adaptively spaced using the bubble of free space around
+/// each sample, such that neither the robot (moving with its maximal joint velocities) nor any obstacle (moving with its maximal 
+/// velocity) can traverse the clearance between two consecutive samples.
+/// @param max_time Maximal time in [s] for the validation. If it is exceeded, only the state at 't_end' is additionally checked, 
+/// while the rest of the spline is left to 'checkMotionValidity'.
+/// @return Whether the spline is collision-free.
+/// @note All samples are checked using the preallocated state 'q_check'.
+bool planning::drbt::DRGBT::validateSpline(const std::shared_ptr<planning::trajectory::Spline> spline, float t_begin, float t_end, 
+    float delta_time, float max_time)
+{
+    std::chrono::steady_clock::time_point time_start_ { std::chrono::steady_clock::now() };
+    float obs_max_vel { 0 };
+    for (const env::ObstacleDescriptor &obs : ss->env->getObstacleTable())
+        obs_max_vel = std::max(obs_max_vel, obs.max_vel);
+
+    float t { t_begin };
+    float d_c { 0 };
+    float step { 0 };
+    while (getElapsedTime(time_start_) < max_time)
+    {
+        spline->getPosition(t, coord_spline);
+        q_check->setCoord(coord_spline);
+        d_c = ss->computeDistanceAt(q_check, t + delta_time);
+        if (d_c <= 0)
+            return false;
+        else if (t >= t_end)
+            return true;
+
+        // The robot cannot move more than 'd_c / step' in W-space during one second
+        coord_spline += robot_max_vel;
+        q_check_max_vel->setCoord(coord_spline);
+        step = ss->robot->computeStep(q_check, q_check_max_vel, d_c, 0, ss->robot->computeSkeleton(q_check));
+        t = std::min(t + d_c / (d_c / step + obs_max_vel), t_end);
+    }
+
+    // std::cout << "Spline is validated until " << t << " [s] out of " << t_end << " [s] \n";
+    spline->getPosition(t_end, coord_spline);
+    q_check->setCoord(coord_spline);
+    return ss->isValidAt(q_check, t_end + delta_time);
+}
+
+// Compute an emergency stop from the state of the robot at time 't' in [s] on 'spline'. 
+// Each joint stops as fast as possible, and braking times are taken from 'braking_table'.
+// The stop is returned even if it violates the velocity limit, since no other spline can stop the robot faster.
+std::shared_ptr<planning::trajectory::Spline4> planning::drbt::DRGBT::computeEmergencyStop
+    (const std::shared_ptr<planning::trajectory::Spline> spline, float t)
+{
+    spline->getPosition(t, coord_spline);
+    spline->getVelocity(t, vel_spline);
+    spline->getAcceleration(t, acc_spline);
+    std::shared_ptr<planning::trajectory::Spline4> spline_stop { spline_pool->acquireSpline4(coord_spline, vel_spline, acc_spline) };
+    spline_stop->compute();
+
+    return spline_stop;
+}
+
+// Collect waypoints through which 'spline_next' is required to pass. The first one is 'q_next_reached'. 
+// If 'q_next' is a reached state from the predefined path, the following good and reached path states from the horizon are added, 
+// such that at most 'TRAJECTORY_WINDOW_SIZE' waypoints are collected.
+void planning::drbt::DRGBT::collectSplineWaypoints()
+{
+    spline_waypoints.clear();
+    spline_waypoints.emplace_back(q_next->getStateReached()->getCoord());
+
+    int idx { q_next->getIndex() };
+    if (DRGBTConfig::TRAJECTORY_WINDOW_SIZE < 2 || idx < 0 || idx >= int(predefined_path.size()) || 
+        q_next->getState() != predefined_path[idx] || !q_next->getIsReached())
+        return;
+    
+    for (idx++; idx < int(predefined_path.size()) && spline_waypoints.size() < DRGBTConfig::TRAJECTORY_WINDOW_SIZE; idx++)
+    {
+        std::shared_ptr<planning::drbt::HorizonState> q_path { nullptr };
+        for (std::shared_ptr<planning::drbt::HorizonState> q : horizon)
+        {
+            if (q->getIndex() == idx && q->getState() == predefined_path[idx])
+            {
+                q_path = q;
+                break;
+            }
+        }
+
+        if (q_path == nullptr || q_path->getStatus() != planning::drbt::HorizonState::Status::Good || !q_path->getIsReached())
+            break;
+        
+        spline_waypoints.emplace_back(q_path->getStateReached()->getCoord());
+    }
+}
+
 bool planning::drbt::DRGBT::changeNextState(std::vector<std::shared_ptr<planning::drbt::HorizonState>> &visited_states)
 {
     // std::cout << "Change of q_next is required! \n";
@@ -890,10 +1230,14 @@ void planning::drbt::DRGBT::replan(float max_planning_time)
         if (result && planner->getPlannerInfo()->getPlanningTime() <= max_planning_time)
         {
             // std::cout << "The path has been replanned in " << planner->getPlannerInfo()->getPlanningTime() * 1000 << " [ms]. \n";
-            acquirePredefinedPath(planner->getPath());
+            if (DRGBTConfig::PATH_SIMPLIFICATION)   // The remaining time for replanning is used for the simplification
+                acquirePredefinedPath(path_simplifier->simplify(planner->getPath(), 
+                                      max_planning_time - planner->getPlannerInfo()->getPlanningTime()));
+            else
+                acquirePredefinedPath(planner->getPath());
             clearHorizon(base::State::Status::Reached, false);
-            q_next = std::make_shared<planning::drbt::HorizonState>(q_target, 0);
-            planner_info->addRoutineTime(planner->getPlannerInfo()->getPlanningTime() * 1e3, 0);  // replan
+            q_next = horizon_state_pool->acquire(q_target, 0);
+            addRoutineTime(planner->getPlannerInfo()->getPlanningTime() * 1e3, 0);  // replan
         }
         else    // New path is not found, and just continue with the previous motion. We can also impose the robot to stop.
             throw std::runtime_error("New path is not found! ");
@@ -972,8 +1316,18 @@ bool planning::drbt::DRGBT::checkMotionValidity(size_t num_checks)
     size_t num_checks2 { num_checks - num_checks1 };
     float delta_time1 { (spline_current->getTimeCurrent() - spline_current->getTimeBegin()) / num_checks1 };
     float delta_time2 { (spline_next->getTimeEnd() - spline_next->getTimeCurrent()) / num_checks2 };
-    float t { 0 };
     bool is_valid { true };
+
+    // Positions at all check times are computed at once for each spline, where the first 'num_checks1' times belong to 
+    // 'spline_current', and the remaining ones to 'spline_next'. Both splines are evaluated at all times, so the sizes 
+    // of the preallocated matrices do not change through iterations.
+    check_times.resize(num_checks);
+    for (size_t k = 0; k < num_checks; k++)
+        check_times(k) = (k < num_checks1) ? spline_current->getTimeBegin() + delta_time1 * (k + 1) 
+                                           : spline_next->getTimeCurrent() + delta_time2 * (k - num_checks1 + 1);
+    
+    spline_current->evaluate(check_times, check_positions_current);
+    spline_next->evaluate(check_times, check_positions_next);
     
     // std::cout << "Current spline times:   " << spline_current->getTimeBegin() * 1000 << " [ms] \t"
     //                                         << spline_current->getTimeCurrent() * 1000 << " [ms] \t"
@@ -982,26 +1336,35 @@ bool planning::drbt::DRGBT::checkMotionValidity(size_t num_checks)
     //                                         << spline_next->getTimeCurrent() * 1000 << " [ms] \t"
     //                                         << spline_next->getTimeEnd() * 1000 << " [ms] \n";
 
+    bool is_goal { false };
     for (size_t num_check = 1; num_check <= num_checks; num_check++)
     {
         if (num_check <= num_checks1)
         {
-            t = spline_current->getTimeBegin() + num_check * delta_time1;
-            q_current = ss->getNewState(spline_current->getPosition(t));
-            // std::cout << "t: " << t * 1000 << " [ms]\t from curr. spline \t" << q_current << "\n";
+            coord_spline = check_positions_current.col(num_check - 1);
+            // std::cout << "Check: " << num_check << "\t from curr. spline \t" << coord_spline.transpose() << "\n";
             ss->env->updateEnvironment(delta_time1);
         }
         else
         {
-            t = spline_next->getTimeCurrent() + (num_check - num_checks1) * delta_time2;
-            q_current = ss->getNewState(spline_next->getPosition(t));
-            // std::cout << "t: " << t * 1000 << " [ms]\t from next  spline \t" << q_current << "\n";
+            coord_spline = check_positions_next.col(num_check - 1);
+            // std::cout << "Check: " << num_check << "\t from next  spline \t" << coord_spline.transpose() << "\n";
             ss->env->updateEnvironment(delta_time2);
         }
 
-        path.emplace_back(q_current);
-        is_valid = ss->isValid(q_current);
-        if (!is_valid || ss->isEqual(q_current, q_goal))
+        q_check->setCoord(coord_spline);
+        is_valid = ss->isValid(q_check);
+        is_goal = ss->isEqual(q_check, q_goal);
+
+        // In the low-latency mode, only the last checked state is added to the realized path, 
+        // since adding all checked states would require an allocation for each of them
+        if (!DRGBTConfig::LOW_LATENCY || !is_valid || is_goal || num_check == num_checks)
+        {
+            q_current = ss->getNewState(coord_spline);
+            path.emplace_back(q_current);
+        }
+
+        if (!is_valid || is_goal)
             break;
     }
     
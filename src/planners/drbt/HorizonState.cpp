@@ -1,6 +1,12 @@
 #include "HorizonState.h"
 
 planning::drbt::HorizonState::HorizonState(std::shared_ptr<base::State> state_, int index_)
+{
+    reset(state_, index_);
+}
+
+// Reset all data, such that the horizon state can be reused for 'state_' with 'index_'
+void planning::drbt::HorizonState::reset(std::shared_ptr<base::State> state_, int index_)
 {
     state = state_;
     index = index_;
@@ -10,6 +16,8 @@ planning::drbt::HorizonState::HorizonState(std::shared_ptr<base::State> state_,
     d_c_previous = -1;
     weight = -1;
     is_reached = false;
+    is_lateral = false;
+    handle = -1;
 }
 
 void planning::drbt::HorizonState::setDistance(float d_c_)
@@ -29,6 +37,17 @@ void planning::drbt::HorizonState::setWeight(float weight_)
         setStatus(planning::drbt::HorizonState::Status::Bad);
 }
 
+void planning::drbt::HorizonBlock::reserve(size_t num_states, size_t num_dimensions)
+{
+    coord_reached.resize(num_dimensions, num_states);
+    d_c.resize(num_states);
+    d_c_previous.resize(num_states);
+    weight.resize(num_states);
+    dist_to_goal.resize(num_states);
+    index.resize(num_states);
+    status.resize(num_states);
+}
+
 namespace planning::drbt 
 {
     std::ostream &operator<<(std::ostream &os, const std::shared_ptr<planning::drbt::HorizonState> q)
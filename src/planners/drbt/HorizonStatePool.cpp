@@ -0,0 +1,74 @@
+//
+// Created by agent on 19.10.26.
+//
+
+#include "HorizonStatePool.h"
+
+planning::drbt::HorizonStatePool::HorizonStatePool(const std::shared_ptr<base::StateSpace> ss_, size_t capacity)
+{
+    ss = ss_;
+    next_slot = 0;
+    num_allocations = 0;
+    horizon_states.reserve(capacity);
+    states.reserve(capacity);
+    
+    for (size_t i = 0; i < capacity; i++)
+    {
+        states.emplace_back(ss->getNewState(Eigen::VectorXf::Zero(ss->num_dimensions)));
+        horizon_states.emplace_back(std::make_shared<planning::drbt::HorizonState>(states.back(), -1));
+    }
+}
+
+// Get a horizon state which refers to 'state' (it is not copied), e.g., to a state from the predefined path.
+std::shared_ptr<planning::drbt::HorizonState> planning::drbt::HorizonStatePool::acquire
+    (const std::shared_ptr<base::State> state, int index)
+{
+    std::shared_ptr<planning::drbt::HorizonState> q { horizon_states[getFreeSlot()] };
+    q->reset(state, index);
+    return q;
+}
+
+// Get a horizon state with its own state, whose coordinates are overwritten by 'coord'.
+std::shared_ptr<planning::drbt::HorizonState> planning::drbt::HorizonStatePool::acquire(const Eigen::VectorXf &coord)
+{
+    size_t slot { getFreeSlot() };
+    if (states[slot].use_count() > 1)     // The owned state is still referenced from somewhere else
+    {
+        states[slot] = ss->getNewState(coord);
+        num_allocations++;
+    }
+    else
+    {
+        states[slot]->setCoord(coord);
+        states[slot]->setDistance(-1);
+        states[slot]->setIsRealDistance(false);
+        states[slot]->setEnvVersion(0);
+    }
+
+    std::shared_ptr<planning::drbt::HorizonState> q { horizon_states[slot] };
+    q->reset(states[slot], -1);
+    return q;
+}
+
+// Find a slot with the horizon state which is not used outside the pool. 
+// If all slots are used, the pool is enlarged by one slot.
+size_t planning::drbt::HorizonStatePool::getFreeSlot()
+{
+    for (size_t k = 0; k < horizon_states.size(); k++)
+    {
+        size_t slot { (next_slot + k) % horizon_states.size() };
+        if (horizon_states[slot].use_count() == 1)
+        {
+            // The owned state is released from the horizon state, so it can be recycled
+            horizon_states[slot]->reset(nullptr, -1);
+            next_slot = (slot + 1) % horizon_states.size();
+            return slot;
+        }
+    }
+
+    states.emplace_back(ss->getNewState(Eigen::VectorXf::Zero(ss->num_dimensions)));
+    horizon_states.emplace_back(std::make_shared<planning::drbt::HorizonState>(states.back(), -1));
+    num_allocations++;
+    next_slot = 0;
+    return horizon_states.size() - 1;
+}
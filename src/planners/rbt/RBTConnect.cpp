@@ -35,7 +35,7 @@ bool planning::rbt::RBTConnect::solve()
 		/* Generating bur */
 		// std::cout << "Iteration: " << planner_info->getNumIterations() << "\n";
 		// std::cout << "Num. states: " << planner_info->getNumStates() << "\n";
-		q_e = ss->getRandomState();
+		q_e = sampler->sample();
 		// std::cout << q_rand->getCoord().transpose() << "\n";
 		q_near = trees[tree_idx]->getNearestState(q_e);
 		// std::cout << "Tree: " << trees[treeNum]->getTreeName() << "\n";
@@ -144,24 +144,24 @@ base::State::Status planning::rbt::RBTConnect::connectSpine
 {
 	float d_c { ss->computeDistance(q) };
 	std::shared_ptr<base::State> q_new { q };
-	std::shared_ptr<base::State> q_temp { nullptr };
+	std::shared_ptr<base::State> q_parent { nullptr };
 	base::State::Status status { base::State::Status::Advanced };
 	size_t num_ext { 0 };
 
 	while (status == base::State::Status::Advanced && num_ext++ < RRTConnectConfig::MAX_EXTENSION_STEPS)
 	{
-		q_temp = ss->getNewState(q_new);
+		q_parent = q_new;		// The state which is already in 'tree'
 		if (d_c > RBTConnectConfig::D_CRIT)
 		{
-			tie(status, q_new) = extendSpine(q_temp, q_e);
+			tie(status, q_new) = extendSpine(q_parent, q_e);
 			d_c = ss->computeDistance(q_new);
-			tree->upgradeTree(q_new, q_temp);
+			tree->upgradeTree(q_new, q_parent);
 		}
 		else
 		{
-			tie(status, q_new) = extend(q_temp, q_e);
+			tie(status, q_new) = extend(q_parent, q_e);
 			if (status != base::State::Status::Trapped)
-				tree->upgradeTree(q_new, q_temp);
+				tree->upgradeTree(q_new, q_parent);
 		}
 	}
 	return status;
@@ -36,7 +36,7 @@ bool planning::rbt::RGBTConnect::solve()
 		/* Generating generalized bur */
 		// std::cout << "Iteration: " << planner_info->getNumIterations() << "\n";
 		// std::cout << "Num. states: " << planner_info->getNumStates() << "\n";
-		q_e = ss->getRandomState();
+		q_e = sampler->sample();
 		// std::cout << q_rand->getCoord().transpose() << "\n";
 		q_near = trees[tree_idx]->getNearestState(q_e);
 		// std::cout << "Tree: " << trees[treeNum]->getTreeName() << "\n";
@@ -127,18 +127,18 @@ base::State::Status planning::rbt::RGBTConnect::connectGenSpine
 {
     float d_c { ss->computeDistance(q) };
 	std::shared_ptr<base::State> q_new { q };
-	std::shared_ptr<base::State> q_temp { nullptr };
+	std::shared_ptr<base::State> q_parent { nullptr };
     std::shared_ptr<std::vector<std::shared_ptr<base::State>>> q_new_list { nullptr };
 	base::State::Status status { base::State::Status::Advanced };
 	size_t num_ext { 0 };
 	
 	while (status == base::State::Status::Advanced && num_ext++ < RRTConnectConfig::MAX_EXTENSION_STEPS)
 	{
-		q_temp = ss->getNewState(q_new);
+		q_parent = q_new;		// The state which is already in 'tree'
 		if (d_c > RBTConnectConfig::D_CRIT)
 		{
-			tie(status, q_new_list) = extendGenSpine2(q_temp, q_e);
-            tree->upgradeTree(q_new_list->front(), q_temp);
+			tie(status, q_new_list) = extendGenSpine2(q_parent, q_e);
+            tree->upgradeTree(q_new_list->front(), q_parent);
             for (size_t i = 1; i < q_new_list->size(); i++)
                 tree->upgradeTree(q_new_list->at(i), q_new_list->at(i-1));
 			
@@ -147,9 +147,9 @@ base::State::Status planning::rbt::RGBTConnect::connectGenSpine
 		}
 		else
 		{
-			tie(status, q_new) = extend(q_temp, q_e);
+			tie(status, q_new) = extend(q_parent, q_e);
             if (status != base::State::Status::Trapped)
-                tree->upgradeTree(q_new, q_temp);
+                tree->upgradeTree(q_new, q_parent);
 		}	
 	}
 	return status;
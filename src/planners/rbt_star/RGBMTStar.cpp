@@ -13,6 +13,7 @@
 planning::rbt_star::RGBMTStar::RGBMTStar(const std::shared_ptr<base::StateSpace> ss_) : RGBTConnect(ss_) 
 {
     planner_type = planning::PlannerType::RGBMTStar;
+    worker_pool = std::make_shared<planning::WorkerPool>(ss->isReentrant() ? RGBMTStarConfig::NUM_THREADS : 1);
 }
 
 planning::rbt_star::RGBMTStar::RGBMTStar(const std::shared_ptr<base::StateSpace> ss_, const std::shared_ptr<base::State> q_start_,
@@ -25,6 +26,10 @@ planning::rbt_star::RGBMTStar::RGBMTStar(const std::shared_ptr<base::StateSpace>
     num_states = {1, 1};
     cost_opt = INFINITY;
     q_con_opt = nullptr;
+    worker_pool = std::make_shared<planning::WorkerPool>(ss->isReentrant() ? RGBMTStarConfig::NUM_THREADS : 1);
+    cost_pruned = INFINITY;
+    num_states_pruned = 0;
+    generator.seed(std::random_device{}());
     planner_info->addCostConvergence({INFINITY, INFINITY});
     planner_info->addStateTimes({0, 0});
 }
@@ -55,8 +60,8 @@ bool planning::rbt_star::RGBMTStar::solve()
         
         // Adding a new local tree rooted in 'q_rand'
         trees.emplace_back(std::make_shared<base::Tree>(base::Tree("local", tree_new_idx)));
-        trees[tree_new_idx]->setKdTree(std::make_shared<base::KdTree>(ss->num_dimensions, *trees[tree_new_idx], 
-                                                                      nanoflann::KDTreeSingleIndexAdaptorParams(10)));
+        trees[tree_new_idx]->setNearestNeighbours(base::NearestNeighbours::create(RealVectorSpaceConfig::NEAREST_NEIGHBOURS_TYPE, 
+                                                                                  *trees[tree_new_idx], ss->num_dimensions));
         trees[tree_new_idx]->upgradeTree(q_rand, nullptr);
         trees_exist.clear();
         trees_reached.clear();
@@ -69,7 +74,6 @@ bool planning::rbt_star::RGBMTStar::solve()
         {
             // If the connection with 'q_near' is not possible, attempt to connect with 'parent(q_near)', etc.
             q_near = trees[idx]->getNearestState(q_rand);
-            // q_near = trees[idx]->getNearestState2(q_rand);
             std::shared_ptr<base::State> q_near_new { q_near };
             while (true)
             {
@@ -163,10 +167,17 @@ bool planning::rbt_star::RGBMTStar::solve()
         else    // If there are no reached trees, then the new tree is added to 'trees'
             tree_new_idx += 1;
 
+        // States that cannot improve the path are pruned whenever its cost is improved
+        if (RGBMTStarConfig::INFORMED_SAMPLING && cost_opt < cost_pruned)
+        {
+            pruneTrees();
+            tree_new_idx = trees.size();
+        }
+
 		/* Planner info and terminating condition */
         planner_info->setNumIterations(planner_info->getNumIterations() + 1);
 		planner_info->addIterationTime(getElapsedTime(time_alg_start));
-		size_t num_states_total { 0 };
+		size_t num_states_total { num_states_pruned };
         num_states.resize(trees.size());
         for(size_t idx = 0; idx < trees.size(); idx++)
         {
@@ -190,13 +201,16 @@ std::shared_ptr<base::State> planning::rbt_star::RGBMTStar::getRandomState()
 
     while (true)
     {
-        q_rand = ss->getRandomState();    // Uniform distribution
-        if (planner_info->getNumStates() > 2 * (num_states[0] + num_states[1]))     // If local trees contain more states than main trees
+        if (RGBMTStarConfig::INFORMED_SAMPLING && cost_opt < INFINITY)
+            q_rand = getInformedState();
+        else
+            q_rand = sampler->sample();
+        
+        if (planner_info->getNumStates() - num_states_pruned > 2 * (num_states[0] + num_states[1]))     // If local trees contain more states than main trees
         {
             // std::cout << "Local trees are dominant! \n";
             tree_idx = (num_states[0] < num_states[1]) ? 0 : 1;
             q_near = trees[tree_idx]->getNearestState(q_rand);
-            // q_near = trees[tree_idx]->getNearestState2(q_rand);
             tie(status, q_rand) = connectGenSpine(q_near, q_rand);
             if (status != base::State::Status::Trapped)
                 return q_rand;
@@ -207,6 +221,76 @@ std::shared_ptr<base::State> planning::rbt_star::RGBMTStar::getRandomState()
     return nullptr;
 }
 
+// Return a state uniformly sampled from the prolate hyperspheroid, whose focal points are 'q_start' and 'q_goal', 
+// and transverse diameter is 'cost_opt'. It contains all states that can possibly improve the current path.
+// Since all conjugate diameters are equal, a sample from the unit ball is just stretched along the transverse axis.
+// Samples outside joint limits are rejected, and if all of them are rejected, a sample from 'sampler' is returned.
+std::shared_ptr<base::State> planning::rbt_star::RGBMTStar::getInformedState()
+{
+    const float cost_min { ss->getNorm(q_start, q_goal) };
+    const Eigen::VectorXf center { (q_start->getCoord() + q_goal->getCoord()) / 2 };
+    const Eigen::VectorXf axis { (q_goal->getCoord() - q_start->getCoord()) / std::max(cost_min, 1e-6f) };
+    const float radius_transverse { cost_opt / 2 };
+    const float radius_conjugate { std::sqrt(std::max(cost_opt * cost_opt - cost_min * cost_min, 0.f)) / 2 };
+    std::normal_distribution<float> distribution_normal(0, 1);
+    std::uniform_real_distribution<float> distribution_uniform(0, 1);
+    Eigen::VectorXf x(ss->num_dimensions);
+    Eigen::VectorXf coord(ss->num_dimensions);
+    
+    for (size_t num = 0; num < MAX_NUM_INFORMED_SAMPLES; num++)
+    {
+        for (size_t k = 0; k < ss->num_dimensions; k++)
+            x(k) = distribution_normal(generator);
+        
+        x *= std::pow(distribution_uniform(generator), 1.f / ss->num_dimensions) / x.norm();    // Uniform sample from the unit ball
+        coord = center + radius_conjugate * x + (radius_transverse - radius_conjugate) * axis.dot(x) * axis;
+
+        bool is_within_limits { true };
+        for (size_t k = 0; k < ss->num_dimensions && is_within_limits; k++)
+        {
+            if (coord(k) < ss->robot->getLimits()[k].first || coord(k) > ss->robot->getLimits()[k].second)
+                is_within_limits = false;
+        }
+        
+        if (is_within_limits)
+            return ss->getNewState(coord);
+    }
+
+    return sampler->sample();
+}
+
+// Return a lower bound on the cost of a path from 'q_start' to 'q_goal' that passes through 'q'
+inline float planning::rbt_star::RGBMTStar::computeCostLowerBound(const std::shared_ptr<base::State> q)
+{
+    return ss->getNorm(q_start, q) + ss->getNorm(q, q_goal);
+}
+
+// Prune all states that cannot improve the current path cost 'cost_opt'.
+// A state from the main tree is pruned (together with its descendants) if its cost-to-come plus the cost lower bound to the other main root exceeds 'cost_opt'.
+// A local tree is pruned if the cost lower bound of each its state exceeds 'cost_opt'.
+void planning::rbt_star::RGBMTStar::pruneTrees()
+{
+    const float cost_max { cost_opt + PRUNING_TOLERANCE };
+    num_states_pruned += trees[0]->pruneTree([&](const std::shared_ptr<base::State> q) 
+        { return q->getCost() + ss->getNorm(q, q_goal) > cost_max; });
+    num_states_pruned += trees[1]->pruneTree([&](const std::shared_ptr<base::State> q) 
+        { return q->getCost() + ss->getNorm(q, q_start) > cost_max; });
+    
+    std::vector<size_t> trees_pruned {};
+    for (size_t idx = 2; idx < trees.size(); idx++)
+    {
+        const std::vector<std::shared_ptr<base::State>> &states { *trees[idx]->getStates() };
+        if (std::all_of(states.begin(), states.end(), [&](const std::shared_ptr<base::State> q) 
+            { return computeCostLowerBound(q) > cost_max; }))
+        {
+            trees_pruned.emplace_back(idx);
+            num_states_pruned += states.size();
+        }
+    }
+    deleteTrees(trees_pruned);
+    cost_pruned = cost_opt;
+}
+
 // Connect state 'q' with state 'q_e'
 // Return 'Status'
 // Return 'q_new': the reached state
@@ -253,37 +337,79 @@ inline float planning::rbt_star::RGBMTStar::computeCostToCome(const std::shared_
 // State 'q' from another tree is optimally connected to 'tree'
 // 'q_reached' is a state from 'tree' that is reached by 'q'
 // Return 'q_new': state 'q' which now belongs to 'tree'
+// Connections from 'q' to all predecessors of 'q_reached', as well as to several bisection points, are attempted in parallel
+// by the workers from 'worker_pool' (there is only one worker if the state space is not reentrant). 
+// Distance-to-obstacles for 'q' is computed only once, and then shared by all connections.
 std::shared_ptr<base::State> planning::rbt_star::RGBMTStar::optimize
     (const std::shared_ptr<base::State> q, const std::shared_ptr<base::Tree> tree, std::shared_ptr<base::State> q_reached)
 {
-    // Finding the optimal connection to the predecessors of 'q_reached'
-    std::shared_ptr<base::State> q_parent { q_reached->getParent() };
-    while (q_parent != nullptr)
+    ss->computeDistance(q);
+
+    // Finding the optimal connection to the predecessors of 'q_reached', i.e., the farthest reached predecessor.
+    // Predecessors are considered from the farthest one, so the nearer ones are skipped once a farther one is reached.
+    std::vector<std::shared_ptr<base::State>> predecessors {};
+    for (std::shared_ptr<base::State> q_parent = q_reached->getParent(); q_parent != nullptr; q_parent = q_parent->getParent())
+        predecessors.emplace_back(q_parent);
+    
+    std::atomic<size_t> next_idx { 0 };
+    std::atomic<size_t> num_skipped { 0 };      // All predecessors with index smaller than 'num_skipped - 1' are skipped
+    auto connectPredecessors = [&]([[maybe_unused]] size_t worker_idx)
     {
-        if (std::get<0>(connectGenSpine(q, q_parent)) == base::State::Status::Reached)
-            q_reached = q_parent;
-        q_parent = q_parent->getParent();
-    }
+        for (size_t k = next_idx++; k < predecessors.size(); k = next_idx++)
+        {
+            size_t idx { predecessors.size() - 1 - k };
+            if (idx + 1 < num_skipped)
+                return;
+
+            if (std::get<0>(connectGenSpine(q, predecessors[idx])) == base::State::Status::Reached)
+            {
+                size_t num_skipped_ { num_skipped };
+                while (idx + 1 > num_skipped_ && !num_skipped.compare_exchange_weak(num_skipped_, idx + 1)) {}
+            }
+        }
+    };
+    if (!predecessors.empty())
+        worker_pool->run(connectPredecessors);
+    if (num_skipped > 0)
+        q_reached = predecessors[num_skipped - 1];
 
     std::shared_ptr<base::State> q_opt { nullptr }; 
     if (q_reached->getParent() != nullptr)
     {
+        // Bisection of the edge from 'q_reached' to its parent, where 'num_points' equidistant points are checked in each round.
+        // 'num_rounds' is chosen such that the precision is the same as with 'max_iter' bisection steps.
         Eigen::VectorXf q_opt_ { q_reached->getCoord() };  // It is surely collision-free. It will become an optimal state later
         Eigen::VectorXf q_parent_ { q_reached->getParent()->getCoord() };   // Needs to be collision-checked
-        std::shared_ptr<base::State> q_middle { ss->getRandomState() };
-        size_t max_iter = std::floor(std::log2(10 * ss->getNorm(q_reached->getParent(), q_reached)));
+        size_t max_iter = std::max(std::floor(std::log2(10 * ss->getNorm(q_reached->getParent(), q_reached))), 0.f);
+        const size_t num_points { worker_pool->getNumWorkers() };
+        const size_t num_rounds = std::ceil(max_iter / std::log2(num_points + 1));
+        std::vector<std::shared_ptr<base::State>> q_middles(num_points, nullptr);
+        std::vector<char> reached(num_points, false);     // Not 'std::vector<bool>', since workers write to it concurrently
         bool update { false };
 
-        for (size_t i = 0; i < max_iter; i++)
+        auto connectMiddles = [&](size_t worker_idx)
+        {
+            reached[worker_idx] = std::get<0>(connectGenSpine(q, q_middles[worker_idx])) == base::State::Status::Reached;
+        };
+        for (size_t i = 0; i < num_rounds; i++)
         {
-            q_middle->setCoord((q_opt_ + q_parent_) / 2);
-            if (std::get<0>(connectGenSpine(q, q_middle)) == base::State::Status::Reached)
+            for (size_t k = 0; k < num_points; k++)
+                q_middles[k] = ss->getNewState(q_opt_ + float(k + 1) / (num_points + 1) * (q_parent_ - q_opt_));
+            
+            worker_pool->run(connectMiddles);
+
+            // The farthest reached point becomes 'q_opt_', and the next point becomes 'q_parent_'
+            size_t k { num_points };
+            while (k > 0 && !reached[k-1])
+                k--;
+            
+            if (k < num_points)
+                q_parent_ = q_middles[k]->getCoord();
+            if (k > 0)
             {
-                q_opt_ = q_middle->getCoord();
+                q_opt_ = q_middles[k-1]->getCoord();
                 update = true;
             }
-            else
-                q_parent_ = q_middle->getCoord();
         }
 
         if (update)
@@ -292,16 +418,7 @@ std::shared_ptr<base::State> planning::rbt_star::RGBMTStar::optimize
             q_opt->setCost(q_reached->getParent()->getCost() + computeCostToCome(q_reached->getParent(), q_opt));
             q_opt->addChild(q_reached);
             tree->upgradeTree(q_opt, q_reached->getParent());
-            std::shared_ptr<std::vector<std::shared_ptr<base::State>>> children { q_reached->getParent()->getChildren() };
-
-            for (size_t i = 0; i < children->size(); i++)
-            {
-                if (ss->isEqual(children->at(i), q_reached))
-                {
-                    children->erase(children->begin() + i);     // Deleting the child, since it is previously added in 'upgradeTree' when adding 'q_opt'
-                    break;
-                }
-            }
+            q_reached->getParent()->removeChild(q_reached);     // 'q_opt' is now between 'q_reached' and its previous parent
             q_reached->setParent(q_opt);
         }
         else
@@ -323,8 +440,8 @@ void planning::rbt_star::RGBMTStar::unifyTrees(const std::shared_ptr<base::Tree>
                                                const std::shared_ptr<base::State> q0_con)
 {
     std::shared_ptr<base::State> q_considered { nullptr };
-    std::shared_ptr<base::State> q_con_new { ss->getNewState(q_con) };
-    std::shared_ptr<base::State> q0_con_new { ss->getNewState(q0_con) };
+    std::shared_ptr<base::State> q_con_new { q_con };
+    std::shared_ptr<base::State> q0_con_new { q0_con };
 
     while (true)
     {
@@ -338,31 +455,31 @@ void planning::rbt_star::RGBMTStar::unifyTrees(const std::shared_ptr<base::Tree>
     }
 }
 
-// Consider all children (except 'q_considered', that has already being considered) of 'q', and connect them optimally to 'tree0' 
+// Consider all descendants of 'q' (except the subtree of its child 'q_considered', that has already being considered), 
+// and connect them optimally to 'tree0'. Descendants are traversed iteratively, so there is no risk of stack overflow in large trees
 void planning::rbt_star::RGBMTStar::considerChildren(const std::shared_ptr<base::State> q, const std::shared_ptr<base::Tree> tree0,
                                                      const std::shared_ptr<base::State> q0_con, const std::shared_ptr<base::State> q_considered)
 {
-    // Remove child 'q_considered' of 'q' from 'tree'
-    std::shared_ptr<std::vector<std::shared_ptr<base::State>>> children { q->getChildren() };
-    if (q_considered != nullptr)
+    // Each state is stored together with its connection in 'tree0', to which its children are connected
+    std::vector<std::pair<std::shared_ptr<base::State>, std::shared_ptr<base::State>>> states { {q, q0_con} };
+    std::shared_ptr<base::State> q_parent { nullptr };
+    std::shared_ptr<base::State> q0_parent { nullptr };
+    std::shared_ptr<base::State> q0_con_new { nullptr };
+
+    while (!states.empty())
     {
-        for (size_t i = 0; i < children->size(); i++)
+        std::tie(q_parent, q0_parent) = states.back();
+        states.pop_back();
+        for (const std::shared_ptr<base::State> &child : *q_parent->getChildren())
         {
-            if (ss->isEqual(children->at(i), q_considered))
-            {
-                children->erase(children->begin() + i);
-                break;
-            }
+            if (child == q_considered)
+                continue;
+            
+            q0_con_new = optimize(child, tree0, q0_parent);
+            if (!child->getChildren()->empty())   // child has its own children
+                states.emplace_back(child, q0_con_new);
         }
     }
-
-    std::shared_ptr<base::State> q0_con_new { nullptr };
-    for (size_t i = 0; i < children->size(); i++)
-    {
-        q0_con_new = optimize(children->at(i), tree0, q0_con);
-        if (children->at(i)->getChildren()->size() > 0)   // child has its own children
-            considerChildren(children->at(i), tree0, q0_con_new, nullptr);  // 'nullptr' means that no children will be removed
-    }
 }
 
 // Delete all trees with indices 'idx'
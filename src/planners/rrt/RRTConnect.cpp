@@ -28,8 +28,8 @@ planning::rrt::RRTConnect::RRTConnect(const std::shared_ptr<base::StateSpace> ss
 		
 	trees.emplace_back(std::make_shared<base::Tree>("q_start", 0));
 	trees.emplace_back(std::make_shared<base::Tree>("q_goal", 1));
-	trees[0]->setKdTree(std::make_shared<base::KdTree>(ss->num_dimensions, *trees[0], nanoflann::KDTreeSingleIndexAdaptorParams(10)));
-	trees[1]->setKdTree(std::make_shared<base::KdTree>(ss->num_dimensions, *trees[1], nanoflann::KDTreeSingleIndexAdaptorParams(10)));
+	trees[0]->setNearestNeighbours(base::NearestNeighbours::create(RealVectorSpaceConfig::NEAREST_NEIGHBOURS_TYPE, *trees[0], ss->num_dimensions));
+	trees[1]->setNearestNeighbours(base::NearestNeighbours::create(RealVectorSpaceConfig::NEAREST_NEIGHBOURS_TYPE, *trees[1], ss->num_dimensions));
 	trees[0]->upgradeTree(q_start, nullptr);
 	trees[1]->upgradeTree(q_goal, nullptr);
 	planner_info->setNumIterations(0);
@@ -62,10 +62,9 @@ bool planning::rrt::RRTConnect::solve()
 		/* Extend */
 		// std::cout << "Iteration: " << planner_info->getNumIterations() << "\n";
 		// std::cout << "Num. states: " << planner_info->getNumStates() << "\n";
-		q_rand = ss->getRandomState();
+		q_rand = sampler->sample();
 		// std::cout << q_rand->getCoord().transpose() << "\n";
 		q_near = trees[tree_idx]->getNearestState(q_rand);
-		// q_near = trees[tree_idx]->getNearestState2(q_rand);
 
 		// std::cout << "Tree: " << trees[tree_idx]->getTreeName() << "\n";
 		tie(status, q_new) = extend(q_near, q_rand);
@@ -81,7 +80,6 @@ bool planning::rrt::RRTConnect::solve()
 			// std::cout << "Not Trapped \n";
 			// std::cout << "Trying to connect to: " << q_new->getCoord().transpose() << " from " << trees[tree_idx]->getTreeName() << "\n";
 			q_near = trees[tree_idx]->getNearestState(q_new);
-			// q_near = trees[tree_idx]->getNearestState2(q_new);
 			status = connect(trees[tree_idx], q_near, q_new);
 		}
 		
@@ -125,10 +123,10 @@ base::State::Status planning::rrt::RRTConnect::connect
 
 	while (status == base::State::Status::Advanced && num_ext++ < RRTConnectConfig::MAX_EXTENSION_STEPS)
 	{
-		std::shared_ptr<base::State> q_temp { ss->getNewState(q_new) };
-		tie(status, q_new) = extend(q_temp, q_e);
+		std::shared_ptr<base::State> q_parent { q_new };		// The state which is already in 'tree'
+		tie(status, q_new) = extend(q_parent, q_e);
 		if (status != base::State::Status::Trapped)
-			tree->upgradeTree(q_new, q_temp);
+			tree->upgradeTree(q_new, q_parent);
 	}
 	// std::cout << "Connected. \n";
 	return status;
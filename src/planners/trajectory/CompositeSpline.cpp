@@ -0,0 +1,435 @@
+//
+// Created by agent on 19.10.26.
+//
+
+#include "CompositeSpline.h"
+#include "RealVectorSpaceConfig.h"
+
+planning::trajectory::CompositeSpline::CompositeSpline(const std::shared_ptr<robots::AbstractRobot> robot_,
+    const Eigen::VectorXf &q_current, const Eigen::VectorXf &q_current_dot, const Eigen::VectorXf &q_current_ddot) :
+    Spline(5, robot_, q_current)
+{
+    q_begin = q_begin_ddot = q_final_dot = Eigen::VectorXf::Zero(num_dimensions);
+    reset(q_current, q_current_dot, q_current_ddot);
+}
+
+// Reset all data, such that the spline can be computed again from the given robot's state without any allocation.
+// Subsplines are released, so they can be recycled unless they are reused by some other composite spline.
+void planning::trajectory::CompositeSpline::reset(const Eigen::VectorXf &q_current, const Eigen::VectorXf &q_current_dot, 
+    const Eigen::VectorXf &q_current_ddot)
+{
+    Spline::reset(q_current);
+    q_start = q_current;
+    q_start_dot = q_current_dot;
+    q_start_ddot = q_current_ddot;
+    subsplines.clear();
+    times_connecting.clear();
+}
+
+/// @brief Compute a composite spline that consists of a single subspline, such that robot stops at 'q_final'.
+bool planning::trajectory::CompositeSpline::compute(const Eigen::VectorXf &q_final)
+{
+    return compute(std::vector<Eigen::VectorXf>({ q_final }));
+}
+
+/// @brief Compute a composite spline from 'q_current' through all 'waypoints_', such that robot stops only at the last waypoint.
+/// If some waypoint cannot be passed, robot stops at the waypoint before it, and the remaining waypoints are discarded.
+/// @param waypoints_ Waypoints through which the robot passes.
+/// @param spline_previous Previously computed composite spline, whose subsplines between the same waypoints
+/// (with the same via velocities) are reused instead of being computed again.
+/// @return Success of computing the spline (at least through the first waypoint).
+bool planning::trajectory::CompositeSpline::compute(const std::vector<Eigen::VectorXf> &waypoints_,
+    const std::shared_ptr<planning::trajectory::CompositeSpline> spline_previous)
+{
+    if (waypoints_.empty())
+        return false;
+
+    waypoints = waypoints_;
+    computeViaVelocities();
+    subsplines.clear();
+
+    size_t k { 0 };
+    while (k < waypoints.size())
+    {
+        if (computeSubspline(k, spline_previous))
+        {
+            k++;
+            continue;
+        }
+        else if (k == 0)
+            return false;
+
+        if (via_velocities[k-1].norm() < RealVectorSpaceConfig::EQUALITY_THRESHOLD)
+        {
+            // Robot stops at the previous waypoint, and the remaining waypoints are discarded
+            waypoints.resize(k);
+            via_velocities.resize(k);
+            break;
+        }
+
+        // Robot cannot pass through 'k'-th waypoint, thus the via velocity at the previous waypoint is reduced
+        via_velocities[k-1] *= (via_velocities[k-1].norm() > VIA_VELOCITY_MIN ? 0.5 : 0);
+        subsplines.pop_back();
+        k--;
+    }
+
+    times_connecting.clear();
+    time_final = 0;
+    for (const std::shared_ptr<planning::trajectory::Spline> &subspline : subsplines)
+    {
+        times_connecting.emplace_back(time_final);
+        time_final += subspline->getTimeFinal();
+    }
+
+    return true;
+}
+
+/// @brief Compute a velocity of the robot at each waypoint. Each joint keeps moving through a waypoint only if it does not
+/// change its direction there, and then its velocity is the smaller of the velocities in the adjacent segments,
+/// where each segment is traversed with maximal velocity of the slowest joint. Robot stops at the last waypoint.
+void planning::trajectory::CompositeSpline::computeViaVelocities()
+{
+    via_velocities.resize(waypoints.size());
+    for (Eigen::VectorXf &via_velocity : via_velocities)
+        via_velocity.setZero(num_dimensions);
+    
+    if (waypoints.size() < 2)
+        return;
+
+    // Minimal time needed to traverse each segment
+    segment_times.assign(waypoints.size(), 0);
+    for (size_t k = 0; k < waypoints.size(); k++)
+    {
+        const Eigen::VectorXf &q_prev { k == 0 ? q_start : waypoints[k-1] };
+        for (size_t idx = 0; idx < num_dimensions; idx++)
+            segment_times[k] = std::max(segment_times[k], std::abs(waypoints[k](idx) - q_prev(idx)) / robot->getMaxVel(idx));
+    }
+
+    for (size_t k = 0; k < waypoints.size() - 1; k++)
+    {
+        if (segment_times[k] < RealVectorSpaceConfig::EQUALITY_THRESHOLD ||
+            segment_times[k+1] < RealVectorSpaceConfig::EQUALITY_THRESHOLD)
+            continue;
+
+        const Eigen::VectorXf &q_prev { k == 0 ? q_start : waypoints[k-1] };
+        for (size_t idx = 0; idx < num_dimensions; idx++)
+        {
+            float vel_in { (waypoints[k](idx) - q_prev(idx)) / segment_times[k] };
+            float vel_out { (waypoints[k+1](idx) - waypoints[k](idx)) / segment_times[k+1] };
+            if (vel_in * vel_out > 0)
+                via_velocities[k](idx) = VIA_VELOCITY_SCALE * (vel_in > 0 ? 1 : -1) * std::min(std::abs(vel_in), std::abs(vel_out));
+        }
+    }
+
+    // Backward pass, such that each joint is able to slow down to the via velocity at the next waypoint, 
+    // where a half of maximal acceleration is used to leave a margin for the jerk constraint
+    for (int k = waypoints.size() - 2; k >= 0; k--)
+    {
+        for (size_t idx = 0; idx < num_dimensions; idx++)
+        {
+            float vel_max { std::sqrt(via_velocities[k+1](idx) * via_velocities[k+1](idx) + 
+                                      robot->getMaxAcc(idx) * std::abs(waypoints[k+1](idx) - waypoints[k](idx))) };
+            via_velocities[k](idx) = std::clamp(via_velocities[k](idx), -vel_max, vel_max);
+        }
+    }
+}
+
+/// @brief Compute the 'k'-th subspline, which ends at the 'k'-th waypoint.
+/// If the via velocity cannot be achieved, it is halved, and finally set to zero.
+/// @return Success of computing the subspline.
+bool planning::trajectory::CompositeSpline::computeSubspline(size_t k,
+    const std::shared_ptr<planning::trajectory::CompositeSpline> spline_previous)
+{
+    if (k == waypoints.size() - 1)
+        via_velocities[k].setZero();
+
+    std::shared_ptr<planning::trajectory::Spline> subspline { findSubspline(k, spline_previous) };
+    if (subspline != nullptr)
+    {
+        subsplines.emplace_back(subspline);
+        return true;
+    }
+
+    // Subspline begins where the previous one actually ends, since a subspline which stops at its waypoint
+    // reaches it only approximately
+    std::shared_ptr<planning::trajectory::Spline5> spline5 { nullptr };
+    if (k == 0)
+        spline5 = acquireSubspline(q_start, q_start_dot, q_start_ddot);
+    else
+    {
+        subsplines[k-1]->getPosition(subsplines[k-1]->getTimeFinal(), q_begin);
+        q_begin_ddot.setZero();
+        spline5 = acquireSubspline(q_begin, via_velocities[k-1], q_begin_ddot);
+    }
+
+    for (float scale : {1.0, 0.5, 0.0})
+    {
+        q_final_dot = scale * via_velocities[k];
+        if (spline5->compute(waypoints[k], q_final_dot))
+        {
+            via_velocities[k] *= scale;
+            subsplines.emplace_back(spline5);
+            return true;
+        }
+        else if (via_velocities[k].norm() < RealVectorSpaceConfig::EQUALITY_THRESHOLD)
+            break;
+    }
+
+    return false;
+}
+
+/// @brief Find a subspline in 'spline_previous' that connects the same waypoints with the same via velocities as 'k'-th subspline,
+/// and begins where the previous subspline ends. The first subspline is never reused, since it begins at the current robot's state.
+/// @return The found subspline, or nullptr if it does not exist.
+std::shared_ptr<planning::trajectory::Spline> planning::trajectory::CompositeSpline::findSubspline(size_t k,
+    const std::shared_ptr<planning::trajectory::CompositeSpline> spline_previous)
+{
+    if (spline_previous == nullptr || k == 0)
+        return nullptr;
+
+    auto isEqual = [](const Eigen::VectorXf &q1, const Eigen::VectorXf &q2) -> bool
+    {
+        return (q1 - q2).norm() < RealVectorSpaceConfig::EQUALITY_THRESHOLD;
+    };
+
+    // Whether 'subspline' begins at 'q_begin', where its initial position is not stored to avoid an allocation
+    auto beginsAt = [&](const std::shared_ptr<planning::trajectory::Spline> subspline) -> bool
+    {
+        float dist { 0 };
+        for (size_t idx = 0; idx < num_dimensions; idx++)
+            dist += std::pow(subspline->getPosition(0, idx) - q_begin(idx), 2);
+        
+        return std::sqrt(dist) < RealVectorSpaceConfig::EQUALITY_THRESHOLD;
+    };
+
+    subsplines[k-1]->getPosition(subsplines[k-1]->getTimeFinal(), q_begin);
+    for (size_t i = 1; i < spline_previous->subsplines.size(); i++)
+    {
+        if (isEqual(spline_previous->waypoints[i-1], waypoints[k-1]) &&
+            isEqual(spline_previous->via_velocities[i-1], via_velocities[k-1]) &&
+            isEqual(spline_previous->waypoints[i], waypoints[k]) &&
+            isEqual(spline_previous->via_velocities[i], via_velocities[k]) &&
+            beginsAt(spline_previous->subsplines[i]))
+            return spline_previous->subsplines[i];
+    }
+
+    return nullptr;
+}
+
+// Get a subspline from 'subsplines_owned' which is not referenced elsewhere, and reset it to the given initial state.
+// If all owned subsplines are referenced, a new one is allocated.
+std::shared_ptr<planning::trajectory::Spline5> planning::trajectory::CompositeSpline::acquireSubspline
+    (const Eigen::VectorXf &q_begin_, const Eigen::VectorXf &q_begin_dot_, const Eigen::VectorXf &q_begin_ddot_)
+{
+    for (const std::shared_ptr<planning::trajectory::Spline5> &subspline : subsplines_owned)
+    {
+        if (subspline.use_count() == 1)
+        {
+            subspline->reset(q_begin_, q_begin_dot_, q_begin_ddot_);
+            return subspline;
+        }
+    }
+
+    subsplines_owned.emplace_back(std::make_shared<planning::trajectory::Spline5>(robot, q_begin_, q_begin_dot_, q_begin_ddot_));
+    return subsplines_owned.back();
+}
+
+/// @brief Get the index of a subspline that is active at time 't', and convert 't' to its local time.
+size_t planning::trajectory::CompositeSpline::getSubsplineIndex(float &t)
+{
+    size_t k { 0 };
+    while (k + 1 < times_connecting.size() && t >= times_connecting[k+1])
+        k++;
+
+    if (!times_connecting.empty())
+        t -= times_connecting[k];
+
+    return k;
+}
+
+bool planning::trajectory::CompositeSpline::checkConstraints(size_t idx, [[maybe_unused]] float t_f)
+{
+    for (const std::shared_ptr<planning::trajectory::Spline> &subspline : subsplines)
+    {
+        if (!subspline->checkConstraints(idx, subspline->getTimeFinal()))
+            return false;
+    }
+
+    return true;
+}
+
+std::vector<float> planning::trajectory::CompositeSpline::getMaxVelocityTimes(size_t idx)
+{
+    std::vector<float> t_max {};
+    for (size_t k = 0; k < subsplines.size(); k++)
+    {
+        for (float t : subsplines[k]->getMaxVelocityTimes(idx))
+            t_max.emplace_back(times_connecting[k] + t);
+    }
+
+    return t_max;
+}
+
+std::vector<float> planning::trajectory::CompositeSpline::getMaxAccelerationTimes(size_t idx)
+{
+    std::vector<float> t_max {};
+    for (size_t k = 0; k < subsplines.size(); k++)
+    {
+        for (float t : subsplines[k]->getMaxAccelerationTimes(idx))
+            t_max.emplace_back(times_connecting[k] + t);
+    }
+
+    return t_max;
+}
+
+std::vector<float> planning::trajectory::CompositeSpline::getMaxJerkTimes(size_t idx)
+{
+    std::vector<float> t_max {};
+    for (size_t k = 0; k < subsplines.size(); k++)
+    {
+        for (float t : subsplines[k]->getMaxJerkTimes(idx))
+            t_max.emplace_back(times_connecting[k] + t);
+    }
+
+    return t_max;
+}
+
+/// @brief Evaluate the spline for all joints at all 'times' at once, where consecutive times belonging to the same subspline 
+/// are evaluated together by that subspline.
+/// @param times Time instances in [s].
+/// @param out Matrix of size 'num_dimensions' x 'times.size()', where 'k'-th column corresponds to 'times(k)'.
+/// @param derivative Order of the derivative, i.e., 0 for position, 1 for velocity, 2 for acceleration, and 3 for jerk.
+void planning::trajectory::CompositeSpline::evaluate(const Eigen::VectorXf &times, Eigen::MatrixXf &out, size_t derivative)
+{
+    out.resize(num_dimensions, times.size());
+    if (subsplines.empty())
+    {
+        if (derivative == 0)
+            out = q_start.replicate(1, times.size());
+        else
+            out.setZero();
+        return;
+    }
+
+    // All times are passed to each subspline, so the sizes of 'times_subspline' and 'out_subspline' do not change 
+    // (and they are not reallocated) as long as the number of times is the same
+    size_t k { 0 };
+    while (k < size_t(times.size()))
+    {
+        float t { times(k) };
+        size_t idx { getSubsplineIndex(t) };
+        size_t num { 1 };
+        for (; k + num < size_t(times.size()); num++)
+        {
+            t = times(k + num);
+            if (getSubsplineIndex(t) != idx)
+                break;
+        }
+
+        times_subspline = times.array() - times_connecting[idx];
+        subsplines[idx]->evaluate(times_subspline, out_subspline, derivative);
+        out.middleCols(k, num) = out_subspline.middleCols(k, num);
+        k += num;
+    }
+}
+
+Eigen::VectorXf planning::trajectory::CompositeSpline::getPosition(float t)
+{
+    if (subsplines.empty())
+        return q_start;
+
+    size_t k { getSubsplineIndex(t) };
+    return subsplines[k]->getPosition(t);
+}
+
+float planning::trajectory::CompositeSpline::getPosition(float t, size_t idx)
+{
+    if (subsplines.empty())
+        return q_start(idx);
+
+    size_t k { getSubsplineIndex(t) };
+    return subsplines[k]->getPosition(t, idx);
+}
+
+float planning::trajectory::CompositeSpline::getPosition(float t, size_t idx, float t_f)
+{
+    return getPosition(std::min(t, t_f), idx);
+}
+
+Eigen::VectorXf planning::trajectory::CompositeSpline::getVelocity(float t)
+{
+    if (subsplines.empty())
+        return Eigen::VectorXf::Zero(num_dimensions);
+
+    size_t k { getSubsplineIndex(t) };
+    return subsplines[k]->getVelocity(t);
+}
+
+float planning::trajectory::CompositeSpline::getVelocity(float t, size_t idx)
+{
+    if (subsplines.empty())
+        return 0;
+
+    size_t k { getSubsplineIndex(t) };
+    return subsplines[k]->getVelocity(t, idx);
+}
+
+float planning::trajectory::CompositeSpline::getVelocity(float t, size_t idx, float t_f)
+{
+    if (t >= 0 && t <= t_f)
+        return getVelocity(t, idx);
+
+    return 0;
+}
+
+Eigen::VectorXf planning::trajectory::CompositeSpline::getAcceleration(float t)
+{
+    if (subsplines.empty())
+        return Eigen::VectorXf::Zero(num_dimensions);
+
+    size_t k { getSubsplineIndex(t) };
+    return subsplines[k]->getAcceleration(t);
+}
+
+float planning::trajectory::CompositeSpline::getAcceleration(float t, size_t idx)
+{
+    if (subsplines.empty())
+        return 0;
+
+    size_t k { getSubsplineIndex(t) };
+    return subsplines[k]->getAcceleration(t, idx);
+}
+
+float planning::trajectory::CompositeSpline::getAcceleration(float t, size_t idx, float t_f)
+{
+    if (t >= 0 && t <= t_f)
+        return getAcceleration(t, idx);
+
+    return 0;
+}
+
+Eigen::VectorXf planning::trajectory::CompositeSpline::getJerk(float t)
+{
+    if (subsplines.empty())
+        return Eigen::VectorXf::Zero(num_dimensions);
+
+    size_t k { getSubsplineIndex(t) };
+    return subsplines[k]->getJerk(t);
+}
+
+float planning::trajectory::CompositeSpline::getJerk(float t, size_t idx)
+{
+    if (subsplines.empty())
+        return 0;
+
+    size_t k { getSubsplineIndex(t) };
+    return subsplines[k]->getJerk(t, idx);
+}
+
+float planning::trajectory::CompositeSpline::getJerk(float t, size_t idx, float t_f)
+{
+    if (t >= 0 && t <= t_f)
+        return getJerk(t, idx);
+
+    return 0;
+}
@@ -6,6 +6,14 @@ planning::trajectory::Spline::Spline(size_t order_, const std::shared_ptr<robots
     robot = robot_;
     num_dimensions = robot->getNumDOFs();
     coeff = Eigen::MatrixXf::Zero(num_dimensions, order + 1);
+    coeff_der = Eigen::MatrixXf::Zero(num_dimensions, order + 1);
+    reset(q_current);
+}
+
+// Reset all data, such that the spline can be reused from 'q_current' without any allocation
+void planning::trajectory::Spline::reset(const Eigen::VectorXf &q_current)
+{
+    coeff.setZero();
     coeff.col(0) = q_current;   // All initial conditions are zero, except position
     time_start = std::chrono::steady_clock::now();
     time_final = 0;
@@ -106,6 +114,68 @@ float planning::trajectory::Spline::getJerk(float t, size_t idx)
     return q;
 }
 
+// The same as 'getPosition(t)', but the position is stored in 'q' (of size 'num_dimensions'), so no allocation is needed
+void planning::trajectory::Spline::getPosition(float t, Eigen::VectorXf &q)
+{
+    for (size_t i = 0; i < num_dimensions; i++)
+        q(i) = getPosition(t, i);
+}
+
+// The same as 'getVelocity(t)', but the velocity is stored in 'q' (of size 'num_dimensions'), so no allocation is needed
+void planning::trajectory::Spline::getVelocity(float t, Eigen::VectorXf &q)
+{
+    for (size_t i = 0; i < num_dimensions; i++)
+        q(i) = getVelocity(t, i);
+}
+
+// The same as 'getAcceleration(t)', but the acceleration is stored in 'q' (of size 'num_dimensions'), so no allocation is needed
+void planning::trajectory::Spline::getAcceleration(float t, Eigen::VectorXf &q)
+{
+    for (size_t i = 0; i < num_dimensions; i++)
+        q(i) = getAcceleration(t, i);
+}
+
+/// @brief Evaluate the spline for all joints at all 'times' at once using Horner's scheme.
+/// @param times Time instances in [s].
+/// @param out Matrix of size 'num_dimensions' x 'times.size()', where 'k'-th column corresponds to 'times(k)'.
+/// @param derivative Order of the derivative, i.e., 0 for position, 1 for velocity, 2 for acceleration, and 3 for jerk.
+/// @note After the final time, position remains constant, while all derivatives are zero.
+void planning::trajectory::Spline::evaluate(const Eigen::VectorXf &times, Eigen::MatrixXf &out, size_t derivative)
+{
+    out.resize(num_dimensions, times.size());
+    if (derivative > order)
+    {
+        out.setZero();
+        return;
+    }
+
+    // Coefficients of the derivative are stored in the first 'n+1' columns of 'coeff_der'
+    size_t n { order - derivative };
+    for (size_t j = 0; j <= n; j++)
+    {
+        float factor { 1 };
+        for (size_t i = 0; i < derivative; i++)
+            factor *= j + derivative - i;
+        
+        coeff_der.col(j) = factor * coeff.col(j + derivative);
+    }
+
+    // Clamped times are not stored, so no temporary is allocated
+    const auto t { times.transpose().array().cwiseMax(0).cwiseMin(time_final) };
+    out = coeff_der.col(n).replicate(1, times.size());
+    for (int j = n - 1; j >= 0; j--)
+        out = (out.array().rowwise() * t).colwise() + coeff_der.col(j).array();
+
+    if (derivative > 0)
+    {
+        for (int k = 0; k < times.size(); k++)
+        {
+            if (times(k) < 0 || times(k) > time_final)
+                out.col(k).setZero();
+        }
+    }
+}
+
 void planning::trajectory::Spline::setTimeStart()
 {
     time_start = std::chrono::steady_clock::now();
@@ -0,0 +1,378 @@
+//
+// Created by agent on 19.10.26.
+//
+
+#include "Spline4.h"
+#include "RealVectorSpaceConfig.h"
+
+planning::trajectory::BrakingTable::BrakingTable(const std::shared_ptr<robots::AbstractRobot> robot_, size_t num_vel_, size_t num_acc_)
+{
+    robot = robot_;
+    num_vel = std::max(num_vel_, size_t(2));
+    num_acc = std::max(num_acc_, size_t(2));
+
+    for (size_t idx = 0; idx < robot->getNumDOFs(); idx++)
+    {
+        times.emplace_back(Eigen::MatrixXf(num_vel, num_acc));
+        for (size_t i = 0; i < num_vel; i++)
+        {
+            float vel { i * robot->getMaxVel(idx) / (num_vel - 1) };
+            for (size_t j = 0; j < num_acc; j++)
+            {
+                float acc { -robot->getMaxAcc(idx) + j * 2 * robot->getMaxAcc(idx) / (num_acc - 1) };
+                times[idx](i, j) = computeTime(vel, acc, robot->getMaxAcc(idx), robot->getMaxJerk(idx));
+            }
+        }
+    }
+}
+
+/// @brief Get the braking time in [s] of 'idx'-th joint, which starts braking with velocity 'vel' and acceleration 'acc'.
+/// @return The maximal braking time from the table cell containing '(vel, acc)', or the exact braking time if '(vel, acc)'
+/// is out of the table.
+float planning::trajectory::BrakingTable::getTime(size_t idx, float vel, float acc) const
+{
+    size_t i { 0 }, j { 0 };
+    if (!findCell(idx, vel, acc, i, j))
+        return computeTime(vel, acc, robot->getMaxAcc(idx), robot->getMaxJerk(idx));
+
+    return times[idx].block(i, j, 2, 2).maxCoeff();
+}
+
+/// @brief Get an upper bound on the braking distance in [rad] of 'idx'-th joint, which starts braking with velocity 'vel' 
+/// and acceleration 'acc'.
+/// @note The distance traversed during time 't_f' is 'vel*t_f/2 + acc*t_f²/12', so its absolute value is bounded by 
+/// '|vel|*t_table/2 + |acc|*t_table²/12' for any 't_f <= t_table', where 't_table' is the braking time from the table. 
+/// Thus, the bound holds both for the minimal braking time and for the time from the table. The maximal distance 
+/// over the corners of the table cell would not be a bound, since the distance is not monotonic in '(vel, acc)'.
+float planning::trajectory::BrakingTable::getDistance(size_t idx, float vel, float acc) const
+{
+    float t_table { getTime(idx, vel, acc) };
+    return std::abs(vel) * t_table / 2 + std::abs(acc) * t_table * t_table / 12;
+}
+
+// Find the indices '(i, j)' of the lower corner of the table cell containing '(vel, acc)'. 
+// Return false if '(vel, acc)' is out of the table.
+bool planning::trajectory::BrakingTable::findCell(size_t idx, float vel, float acc, size_t &i, size_t &j) const
+{
+    if (vel < 0)
+    {
+        vel = -vel;
+        acc = -acc;
+    }
+
+    float x { vel / robot->getMaxVel(idx) * (num_vel - 1) };
+    float y { (acc + robot->getMaxAcc(idx)) / (2 * robot->getMaxAcc(idx)) * (num_acc - 1) };
+    if (x > num_vel - 1 || y < 0 || y > num_acc - 1)
+        return false;
+
+    i = std::min(size_t(x), num_vel - 2);
+    j = std::min(size_t(y), num_acc - 2);
+    return true;
+}
+
+/// @brief Compute the minimal time in [s] needed to stop a joint, which starts braking with velocity 'vel'
+/// and acceleration 'acc', such that constraints on maximal acceleration 'max_acc' and maximal jerk 'max_jerk' are satisfied.
+/// The time is found by doubling an initial guess until constraints are satisfied, and then by the bisection method.
+float planning::trajectory::BrakingTable::computeTime(float vel, float acc, float max_acc, float max_jerk)
+{
+    if (std::abs(vel) < RealVectorSpaceConfig::EQUALITY_THRESHOLD && std::abs(acc) < RealVectorSpaceConfig::EQUALITY_THRESHOLD)
+        return 0;
+
+    const size_t max_num_iter_expand { 30 };
+    const size_t max_num_iter_bisect { 20 };
+
+    // When 'acc' is zero, the first guess is the exact braking time
+    float t_upper { std::max({ std::sqrt(6 * std::abs(vel) / max_jerk), 1.5f * std::abs(vel) / max_acc,
+                               2 * std::abs(acc) / max_jerk, RealVectorSpaceConfig::EQUALITY_THRESHOLD }) };
+    float t_lower { 0 };
+    for (size_t num = 0; num < max_num_iter_expand && !checkConstraints(vel, acc, t_upper, max_acc, max_jerk); num++)
+    {
+        t_lower = t_upper;
+        t_upper *= 2;
+    }
+
+    for (size_t num = 0; num < max_num_iter_bisect; num++)
+    {
+        float t_f { (t_lower + t_upper) / 2 };
+        if (checkConstraints(vel, acc, t_f, max_acc, max_jerk))
+            t_upper = t_f;
+        else
+            t_lower = t_f;
+    }
+
+    return t_upper;
+}
+
+/// @brief Compute the distance in [rad] traversed by a joint, which stops during time 't_f',
+/// while starting with velocity 'vel' and acceleration 'acc'.
+float planning::trajectory::BrakingTable::computeDistance(float vel, float acc, float t_f)
+{
+    if (t_f <= 0)
+        return 0;
+
+    // Velocity is v(t) = vel + acc*t + C*t² + D*t³, such that v(t_f) = 0 and v'(t_f) = 0
+    float C { -(3*vel + 2*acc*t_f) / (t_f*t_f) };
+    float D { (2*vel + acc*t_f) / (t_f*t_f*t_f) };
+    return vel*t_f + acc*t_f*t_f/2 + C*t_f*t_f*t_f/3 + D*t_f*t_f*t_f*t_f/4;
+}
+
+/// @brief Check whether a joint can stop during time 't_f', while starting with velocity 'vel' and acceleration 'acc',
+/// such that constraints on maximal acceleration 'max_acc' and maximal jerk 'max_jerk' are satisfied.
+/// @note Jerk is linear, thus its maximum is at the beginning or at the end.
+/// The initial acceleration is not checked, since it cannot be changed.
+bool planning::trajectory::BrakingTable::checkConstraints(float vel, float acc, float t_f, float max_acc, float max_jerk)
+{
+    float C { -(3*vel + 2*acc*t_f) / (t_f*t_f) };
+    float D { (2*vel + acc*t_f) / (t_f*t_f*t_f) };
+
+    // Maximal jerk constraint
+    if (std::abs(2*C) > max_jerk + RealVectorSpaceConfig::EQUALITY_THRESHOLD ||
+        std::abs(2*C + 6*D*t_f) > max_jerk + RealVectorSpaceConfig::EQUALITY_THRESHOLD)
+        return false;
+
+    // Maximal acceleration constraint
+    if (D != 0)
+    {
+        float t_max { -C / (3*D) };
+        if (t_max > 0 && t_max < t_f && std::abs(acc + 2*C*t_max + 3*D*t_max*t_max) > max_acc)
+            return false;
+    }
+
+    return true;
+}
+
+planning::trajectory::Spline4::Spline4(const std::shared_ptr<robots::AbstractRobot> robot_, const Eigen::VectorXf &q_current,
+    const Eigen::VectorXf &q_current_dot, const Eigen::VectorXf &q_current_ddot,
+    const std::shared_ptr<planning::trajectory::BrakingTable> braking_table_) :
+    Spline(4, robot_, q_current)
+{
+    braking_table = braking_table_;
+    b = c = times_final = Eigen::VectorXf::Zero(num_dimensions);
+    reset(q_current, q_current_dot, q_current_ddot);
+}
+
+// Reset all data, such that the spline can be reused from the given robot's state without any allocation
+void planning::trajectory::Spline4::reset(const Eigen::VectorXf &q_current, const Eigen::VectorXf &q_current_dot, 
+    const Eigen::VectorXf &q_current_ddot)
+{
+    Spline::reset(q_current);
+    b.setZero();
+    c.setZero();
+    times_final.setZero();
+    d = q_current_ddot / 2;
+    e = q_current_dot;
+    f = q_current;
+}
+
+/// @brief Compute a quartic spline such that each joint stops as fast as possible, where all constraints on
+/// robot's maximal acceleration and jerk are satisfied. Braking times are taken from 'braking_table' if it is available,
+/// and computed exactly otherwise, or if the time from the table does not satisfy the constraints.
+/// @return Success of computing the spline. It is false if the maximal velocity of any joint is exceeded during braking
+/// (e.g., when the joint starts near its maximal velocity while accelerating), but the spline is computed anyway.
+bool planning::trajectory::Spline4::compute()
+{
+    bool success { true };
+    time_final = 0;
+    for (size_t idx = 0; idx < num_dimensions; idx++)
+    {
+        float t_f { 0 };
+        if (braking_table != nullptr)
+        {
+            t_f = braking_table->getTime(idx, e(idx), 2*d(idx));
+            computeCoefficients(idx, t_f);
+        }
+
+        if (braking_table == nullptr ||
+            (t_f > 0 && !planning::trajectory::BrakingTable::checkConstraints(e(idx), 2*d(idx), t_f,
+                robot->getMaxAcc(idx), robot->getMaxJerk(idx))))
+        {
+            t_f = planning::trajectory::BrakingTable::computeTime(e(idx), 2*d(idx), robot->getMaxAcc(idx), robot->getMaxJerk(idx));
+            computeCoefficients(idx, t_f);
+        }
+
+        times_final(idx) = t_f;
+        time_final = std::max(time_final, t_f);
+        coeff.row(idx) << f(idx), e(idx), d(idx), c(idx), b(idx);
+
+        std::array<float, 2> t_max {};
+        size_t num_t_max { getMaxVelocityTimes(idx, t_max) };
+        for (size_t k = 0; k < num_t_max; k++)
+        {
+            if (std::abs(getVelocity(t_max[k], idx, t_f)) > robot->getMaxVel(idx) + RealVectorSpaceConfig::EQUALITY_THRESHOLD)
+                success = false;
+        }
+    }
+
+    return success;
+}
+
+/// @brief The final configuration cannot be imposed to an emergency brake, thus 'q_final' is ignored,
+/// and the robot stops as fast as possible.
+bool planning::trajectory::Spline4::compute([[maybe_unused]] const Eigen::VectorXf &q_final)
+{
+    return compute();
+}
+
+// Compute coefficients 'b' and 'c' of 'idx'-th joint such that its velocity and acceleration are zero at time 't_f'
+void planning::trajectory::Spline4::computeCoefficients(size_t idx, float t_f)
+{
+    if (t_f <= 0)
+    {
+        b(idx) = c(idx) = d(idx) = e(idx) = 0;
+        return;
+    }
+
+    c(idx) = -(3*e(idx) + 4*d(idx)*t_f) / (3*t_f*t_f);
+    b(idx) = (2*e(idx) + 2*d(idx)*t_f) / (4*t_f*t_f*t_f);
+}
+
+bool planning::trajectory::Spline4::checkConstraints(size_t idx, float t_f)
+{
+    if (t_f <= 0)
+        return true;
+
+    if (!planning::trajectory::BrakingTable::checkConstraints(e(idx), 2*d(idx), t_f, robot->getMaxAcc(idx), robot->getMaxJerk(idx)))
+        return false;
+
+    std::array<float, 2> t_max {};
+    size_t num_t_max { getMaxVelocityTimes(idx, t_max) };
+    for (size_t k = 0; k < num_t_max; k++)
+    {
+        if (std::abs(getVelocity(t_max[k], idx, t_f)) > robot->getMaxVel(idx))
+            return false;
+    }
+
+    return true;
+}
+
+std::vector<float> planning::trajectory::Spline4::getMaxVelocityTimes(size_t idx)
+{
+    std::array<float, 2> t_max {};
+    return std::vector<float>(t_max.begin(), t_max.begin() + getMaxVelocityTimes(idx, t_max));
+}
+
+// The same as 'getMaxVelocityTimes(idx)', but times are stored in 't_max', and their number is returned
+size_t planning::trajectory::Spline4::getMaxVelocityTimes(size_t idx, std::array<float, 2> &t_max)
+{
+    if (b(idx) == 0)
+    {
+        if (c(idx) == 0)
+            return 0;
+
+        t_max[0] = -d(idx) / (3*c(idx));
+        return 1;
+    }
+
+    float D = 36*c(idx)*c(idx) - 96*b(idx)*d(idx);
+    if (D < 0)
+        return 0;
+    
+    t_max[0] = (-6*c(idx) - std::sqrt(D)) / (24*b(idx));
+    t_max[1] = (-6*c(idx) + std::sqrt(D)) / (24*b(idx));
+    return 2;
+}
+
+std::vector<float> planning::trajectory::Spline4::getMaxAccelerationTimes(size_t idx)
+{
+    std::vector<float> t_max {};
+    if (b(idx) != 0)
+        t_max.emplace_back(-c(idx) / (4*b(idx)));
+
+    return t_max;
+}
+
+// Jerk is linear, thus it has no extrema inside the time interval
+std::vector<float> planning::trajectory::Spline4::getMaxJerkTimes([[maybe_unused]] size_t idx)
+{
+    return {};
+}
+
+/// @brief Evaluate the spline for all joints at all 'times' at once using Horner's scheme, 
+/// where each joint is evaluated until its own braking time.
+/// @param times Time instances in [s].
+/// @param out Matrix of size 'num_dimensions' x 'times.size()', where 'k'-th column corresponds to 'times(k)'.
+/// @param derivative Order of the derivative, i.e., 0 for position, 1 for velocity, 2 for acceleration, and 3 for jerk.
+void planning::trajectory::Spline4::evaluate(const Eigen::VectorXf &times, Eigen::MatrixXf &out, size_t derivative)
+{
+    out.resize(num_dimensions, times.size());
+    for (size_t idx = 0; idx < num_dimensions; idx++)
+    {
+        // Clamped times are not stored, so no temporary is allocated
+        const auto t { times.transpose().array().cwiseMax(0).cwiseMin(times_final(idx)) };
+        switch (derivative)
+        {
+        case 0:
+            out.row(idx) = (((b(idx) * t + c(idx)) * t + d(idx)) * t + e(idx)) * t + f(idx);
+            break;
+        case 1:
+            out.row(idx) = ((4*b(idx) * t + 3*c(idx)) * t + 2*d(idx)) * t + e(idx);
+            break;
+        case 2:
+            out.row(idx) = (12*b(idx) * t + 6*c(idx)) * t + 2*d(idx);
+            break;
+        case 3:
+            out.row(idx) = 24*b(idx) * t + 6*c(idx);
+            break;
+        default:
+            out.row(idx).setZero();
+            break;
+        }
+
+        if (derivative > 0)
+            out.row(idx) = (times.transpose().array() < 0 || times.transpose().array() > times_final(idx)).select(0, out.row(idx));
+    }
+}
+
+float planning::trajectory::Spline4::getPosition(float t, size_t idx)
+{
+    return getPosition(t, idx, times_final(idx));
+}
+
+float planning::trajectory::Spline4::getPosition(float t, size_t idx, float t_f)
+{
+    if (t < 0)
+        t = 0;
+    else if (t > t_f)
+        t = t_f;
+
+    return f(idx) + e(idx)*t + d(idx)*t*t + c(idx)*t*t*t + b(idx)*t*t*t*t;
+}
+
+float planning::trajectory::Spline4::getVelocity(float t, size_t idx)
+{
+    return getVelocity(t, idx, times_final(idx));
+}
+
+float planning::trajectory::Spline4::getVelocity(float t, size_t idx, float t_f)
+{
+    if (t >= 0 && t <= t_f)
+        return e(idx) + 2*d(idx)*t + 3*c(idx)*t*t + 4*b(idx)*t*t*t;
+
+    return 0;
+}
+
+float planning::trajectory::Spline4::getAcceleration(float t, size_t idx)
+{
+    return getAcceleration(t, idx, times_final(idx));
+}
+
+float planning::trajectory::Spline4::getAcceleration(float t, size_t idx, float t_f)
+{
+    if (t >= 0 && t <= t_f)
+        return 2*d(idx) + 6*c(idx)*t + 12*b(idx)*t*t;
+
+    return 0;
+}
+
+float planning::trajectory::Spline4::getJerk(float t, size_t idx)
+{
+    return getJerk(t, idx, times_final(idx));
+}
+
+float planning::trajectory::Spline4::getJerk(float t, size_t idx, float t_f)
+{
+    if (t >= 0 && t <= t_f)
+        return 6*c(idx) + 24*b(idx)*t;
+
+    return 0;
+}
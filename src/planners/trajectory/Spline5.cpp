@@ -1,6 +1,9 @@
 #include "Spline5.h"
 #include "RealVectorSpaceConfig.h"
 
+#include <limits>
+#include <cassert>
+
 // #include <unsupported/Eigen/Polynomials>
 
 planning::trajectory::Spline5::Spline5(const std::shared_ptr<robots::AbstractRobot> robot_, const Eigen::VectorXf &q_current) :
@@ -15,6 +18,17 @@ planning::trajectory::Spline5::Spline5(const std::shared_ptr<robots::AbstractRob
     Spline(5, robot_, q_current)
 {
     a = b = c = Eigen::VectorXf::Zero(num_dimensions);
+    reset(q_current, q_current_dot, q_current_ddot);
+}
+
+// Reset all data, such that the spline can be reused from the given robot's state without any allocation
+void planning::trajectory::Spline5::reset(const Eigen::VectorXf &q_current, const Eigen::VectorXf &q_current_dot, 
+    const Eigen::VectorXf &q_current_ddot)
+{
+    Spline::reset(q_current);
+    a.setZero();
+    b.setZero();
+    c.setZero();
     d = q_current_ddot / 2;
     e = q_current_dot;
     f = q_current;
@@ -33,6 +47,22 @@ bool planning::trajectory::Spline5::compute(const Eigen::VectorXf &q_final)
     Eigen::Vector3f abc_left {}, abc_right {};       // a, b and c coefficients, respectively
     const size_t max_num_iter { 5 };
 
+    // Final times for the minimal and maximal jerk coefficient 'c' do not depend on other joints, 
+    // thus they are computed for all joints at once
+    const bool use_batch { num_dimensions <= MAX_NUM_DOFS };
+    ArrayJ c_left_all {}, t_f_left_all {}, a_left_all {}, b_left_all {};
+    ArrayJ c_right_all {}, t_f_right_all {}, a_right_all {}, b_right_all {};
+    if (use_batch)
+    {
+        c_right_all.resize(num_dimensions);
+        for (size_t idx = 0; idx < num_dimensions; idx++)
+            c_right_all(idx) = robot->getMaxJerk(idx) / 6;
+        
+        c_left_all = -c_right_all;
+        computeFinalTimes(c_left_all, q_final, t_f_left_all, a_left_all, b_left_all);
+        computeFinalTimes(c_right_all, q_final, t_f_right_all, a_right_all, b_right_all);
+    }
+
     for (size_t idx = 0; idx < num_dimensions; idx++)
     {
         // std::cout << "Joint: " << idx << " ---------------------------------------------------\n";
@@ -65,13 +95,23 @@ bool planning::trajectory::Spline5::compute(const Eigen::VectorXf &q_final)
             }
         }
 
-        c(idx) = -robot->getMaxJerk(idx) / 6;
-        t_f_left = computeFinalTime(idx, q_final(idx));
-        abc_left << a(idx), b(idx), c(idx);
+        if (use_batch)
+        {
+            t_f_left = t_f_left_all(idx);
+            abc_left << a_left_all(idx), b_left_all(idx), c_left_all(idx);
+            t_f_right = t_f_right_all(idx);
+            abc_right << a_right_all(idx), b_right_all(idx), c_right_all(idx);
+        }
+        else
+        {
+            c(idx) = -robot->getMaxJerk(idx) / 6;
+            t_f_left = computeFinalTime(idx, q_final(idx));
+            abc_left << a(idx), b(idx), c(idx);
 
-        c(idx) = robot->getMaxJerk(idx) / 6;
-        t_f_right = computeFinalTime(idx, q_final(idx));
-        abc_right << a(idx), b(idx), c(idx);
+            c(idx) = robot->getMaxJerk(idx) / 6;
+            t_f_right = computeFinalTime(idx, q_final(idx));
+            abc_right << a(idx), b(idx), c(idx);
+        }
 
         // std::cout << "t_f_left: " << t_f_left << "\t t_f_right: " << t_f_right << "\n";
         if ((t_f_left == INFINITY) && (t_f_right == INFINITY || t_f_left == 0) && (t_f_right == 0))
@@ -173,6 +213,96 @@ bool planning::trajectory::Spline5::compute(const Eigen::VectorXf &q_final)
     return true;
 }
 
+/// @brief Compute a quintic spline from 'q_current' to 'q_final' such that robot passes through 'q_final' with velocity 'q_final_dot' 
+/// and zero acceleration, where all constraints on robot's maximal velocity, acceleration and jerk are satisfied.
+/// @param q_final Final configuration in which the spline is ending.
+/// @param q_final_dot Final velocity in 'q_final'.
+/// @return Success of computing the spline.
+/// @note Final time is the same for all joints. Since constraints are not monotonic in time when the final velocity is not zero,
+/// the time is gradually increased until constraints are satisfied, and then refined by the bisection method. 
+/// If 'q_final_dot' is zero, the time-optimal 'compute(q_final)' is used.
+bool planning::trajectory::Spline5::compute(const Eigen::VectorXf &q_final, const Eigen::VectorXf &q_final_dot)
+{
+    if (q_final_dot.norm() < RealVectorSpaceConfig::EQUALITY_THRESHOLD)
+        return compute(q_final);
+
+    const size_t max_num_iter_expand { 30 };
+    const size_t max_num_iter_bisect { 10 };
+    const float expand_factor { 1.2 };
+
+    // No joint can move faster than its maximal velocity.
+    // The first guess is a time when the slowest joint moves with a constant acceleration.
+    float t_lower { 0 }, t_guess { 0 };
+    for (size_t idx = 0; idx < num_dimensions; idx++)
+    {
+        if (std::abs(q_final_dot(idx)) > robot->getMaxVel(idx))
+            return false;
+        
+        t_lower = std::max(t_lower, std::abs(q_final(idx) - f(idx)) / robot->getMaxVel(idx));
+        if (std::abs(e(idx) + q_final_dot(idx)) > RealVectorSpaceConfig::EQUALITY_THRESHOLD)
+            t_guess = std::max(t_guess, 2 * (q_final(idx) - f(idx)) / (e(idx) + q_final_dot(idx)));
+    }
+
+    float t_upper { std::max(t_lower, RealVectorSpaceConfig::EQUALITY_THRESHOLD) };
+    bool found { false };
+    if (t_guess > t_upper && computeCoefficients(q_final, q_final_dot, t_guess))
+    {
+        t_upper = t_guess;
+        found = true;
+    }
+
+    for (size_t num = 0; num < max_num_iter_expand && !found; num++)
+    {
+        if (computeCoefficients(q_final, q_final_dot, t_upper))
+        {
+            found = true;
+            break;
+        }
+        t_lower = t_upper;
+        t_upper *= expand_factor;
+    }
+
+    if (!found)
+        return false;
+    
+    for (size_t num = 0; num < max_num_iter_bisect; num++)
+    {
+        float t_f { (t_lower + t_upper) / 2 };
+        if (computeCoefficients(q_final, q_final_dot, t_f))
+            t_upper = t_f;
+        else
+            t_lower = t_f;
+    }
+
+    computeCoefficients(q_final, q_final_dot, t_upper);
+    time_final = t_upper;
+    for (size_t idx = 0; idx < num_dimensions; idx++)
+        coeff.row(idx) << f(idx), e(idx), d(idx), c(idx), b(idx), a(idx);
+    
+    return true;
+}
+
+/// @brief Compute coefficients 'a', 'b' and 'c' such that all joints reach 'q_final' with velocity 'q_final_dot' 
+/// and zero acceleration at time 't_f'.
+/// @return Whether all constraints are satisfied.
+bool planning::trajectory::Spline5::computeCoefficients(const Eigen::VectorXf &q_final, const Eigen::VectorXf &q_final_dot, float t_f)
+{
+    bool satisfied { true };
+    for (size_t idx = 0; idx < num_dimensions; idx++)
+    {
+        float h { q_final(idx) - f(idx) - e(idx)*t_f - d(idx)*t_f*t_f };    // Remaining position
+        float h_dot { q_final_dot(idx) - e(idx) - 2*d(idx)*t_f };           // Remaining velocity
+        float h_ddot { -2*d(idx) };                                         // Remaining acceleration
+        c(idx) = (10*h - 4*h_dot*t_f + h_ddot*t_f*t_f/2) / (t_f*t_f*t_f);
+        b(idx) = (-15*h + 7*h_dot*t_f - h_ddot*t_f*t_f) / (t_f*t_f*t_f*t_f);
+        a(idx) = (6*h - 3*h_dot*t_f + h_ddot*t_f*t_f/2) / (t_f*t_f*t_f*t_f*t_f);
+        if (satisfied && !checkConstraints(idx, t_f))
+            satisfied = false;
+    }
+
+    return satisfied;
+}
+
 /// @brief Compute a final time, i.e., a time to reach from 'q_current(idx)' to 'q_final(idx)'.
 /// @param idx Index of robot's joint
 /// @param q_f_i Final 'idx'-th desired configuration
@@ -181,10 +311,11 @@ bool planning::trajectory::Spline5::compute(const Eigen::VectorXf &q_final)
 float planning::trajectory::Spline5::computeFinalTime(size_t idx, float q_f_i)
 {
     float t_f { INFINITY };
-    std::vector<float> t_sol { solveQubicEquation(c(idx), 3*d(idx), 6*e(idx), 10*(f(idx) - q_f_i)) };
+    std::array<float, 3> t_sol {};
+    size_t num_sol { solveQubicEquation(c(idx), 3*d(idx), 6*e(idx), 10*(f(idx) - q_f_i), t_sol) };
 
     // std::cout << "For c: " << c(idx) << ", it follows t_f: ";
-    for (size_t i = 0; i < t_sol.size(); i++)
+    for (size_t i = 0; i < num_sol; i++)
     {
         // std::cout << t_sol[i] << "\t";
         if (t_sol[i] > 0)
@@ -212,8 +343,9 @@ bool planning::trajectory::Spline5::checkConstraints(size_t idx, float t_f)
     // Maximal jerk constraint
     // std::cout << "\t Max. jerk.\t t_f: " << 0 << "\t value: " << 6 * std::abs(c(idx)) << "\n";
     // std::cout << "\t Max. jerk.\t t_f: " << t_f << "\t value: " << std::abs(getJerk(t_f, idx, t_f)) << "\n";
-    std::vector<float> t_max { getMaxJerkTimes(idx) };
-    for (size_t i = 0; i < t_max.size(); i++)
+    std::array<float, 3> t_max {};
+    size_t num_t_max { getMaxJerkTimes(idx, t_max) };
+    for (size_t i = 0; i < num_t_max; i++)
     {
         // std::cout << "\t Max. jerk.\t t_max: " << t_max[i] << "\t value: " << std::abs(getJerk(t_max[i], idx, t_f)) << "\n";
         if (6 * std::abs(c(idx)) > robot->getMaxJerk(idx) + RealVectorSpaceConfig::EQUALITY_THRESHOLD ||
@@ -227,8 +359,8 @@ bool planning::trajectory::Spline5::checkConstraints(size_t idx, float t_f)
 
     // Maximal acceleration constraint
     // Note: Initial and final acceleration are zero!
-    t_max = getMaxAccelerationTimes(idx);
-    for (size_t i = 0; i < t_max.size(); i++)
+    num_t_max = getMaxAccelerationTimes(idx, t_max);
+    for (size_t i = 0; i < num_t_max; i++)
     {
         // std::cout << "\t Max. acceleration.\t t_max: " << t_max[i] << "\t value: " << std::abs(getAcceleration(t_max[i], idx, t_f)) << "\n";
         if (std::abs(getAcceleration(t_max[i], idx, t_f)) > robot->getMaxAcc(idx))
@@ -240,8 +372,8 @@ bool planning::trajectory::Spline5::checkConstraints(size_t idx, float t_f)
 
     // Maximal velocity constraint
     // Note: Initial and final velocity are zero!
-    t_max = getMaxVelocityTimes(idx);
-    for (size_t i = 0; i < t_max.size(); i++)
+    num_t_max = getMaxVelocityTimes(idx, t_max);
+    for (size_t i = 0; i < num_t_max; i++)
     {
         // std::cout << "\t Max. velocity.\t t_max: " << t_max[i] << "\t value: " << std::abs(getVelocity(t_max[i], idx, t_f)) << "\n";
         if (std::abs(getVelocity(t_max[i], idx, t_f)) > robot->getMaxVel(idx))
@@ -257,34 +389,53 @@ bool planning::trajectory::Spline5::checkConstraints(size_t idx, float t_f)
 
 std::vector<float> planning::trajectory::Spline5::getMaxVelocityTimes(size_t idx)
 {
-    return solveQubicEquation(20*a(idx), 12*b(idx), 6*c(idx), 2*d(idx));
+    std::array<float, 3> t_max {};
+    return std::vector<float>(t_max.begin(), t_max.begin() + getMaxVelocityTimes(idx, t_max));
 }
 
 std::vector<float> planning::trajectory::Spline5::getMaxAccelerationTimes(size_t idx)
 {
-    std::vector<float> t_max {};
+    std::array<float, 3> t_max {};
+    return std::vector<float>(t_max.begin(), t_max.begin() + getMaxAccelerationTimes(idx, t_max));
+}
+
+std::vector<float> planning::trajectory::Spline5::getMaxJerkTimes(size_t idx)
+{
+    std::array<float, 3> t_max {};
+    return std::vector<float>(t_max.begin(), t_max.begin() + getMaxJerkTimes(idx, t_max));
+}
 
+// The same as 'getMaxVelocityTimes(idx)', but times are stored in 't_max', and their number is returned
+size_t planning::trajectory::Spline5::getMaxVelocityTimes(size_t idx, std::array<float, 3> &t_max)
+{
+    return solveQubicEquation(20*a(idx), 12*b(idx), 6*c(idx), 2*d(idx), t_max);
+}
+
+// The same as 'getMaxAccelerationTimes(idx)', but times are stored in 't_max', and their number is returned
+size_t planning::trajectory::Spline5::getMaxAccelerationTimes(size_t idx, std::array<float, 3> &t_max)
+{
+    size_t num { 0 };
     if (a(idx) != 0)
     {
         float D = 576*b(idx)*b(idx) - 1440*a(idx)*c(idx);
         if (D >= 0)
         {
             for (int sign : {-1, 1})
-                t_max.emplace_back((-24*b(idx) + sign*std::sqrt(D)) / (120*a(idx)));
+                t_max[num++] = (-24*b(idx) + sign*std::sqrt(D)) / (120*a(idx));
         }
     }
 
-    return t_max;
+    return num;
 }
 
-std::vector<float> planning::trajectory::Spline5::getMaxJerkTimes(size_t idx)
+// The same as 'getMaxJerkTimes(idx)', but times are stored in 't_max', and their number is returned
+size_t planning::trajectory::Spline5::getMaxJerkTimes(size_t idx, std::array<float, 3> &t_max)
 {
-    std::vector<float> t_max {};
-
+    size_t num { 0 };
     if (a(idx) != 0)
-        t_max.emplace_back(-b(idx) / (5*a(idx)));
+        t_max[num++] = -b(idx) / (5*a(idx));
 
-    return t_max;
+    return num;
 }
 
 float planning::trajectory::Spline5::getPosition(float t, size_t idx, float t_f)
@@ -326,9 +477,10 @@ float planning::trajectory::Spline5::getJerk(float t, size_t idx, float t_f)
 /// @param b real coefficient next to t²
 /// @param c real coefficient next to t¹
 /// @param d real coefficient next to t⁰
-/// @return Only real solutions
+/// @param roots Only real solutions
+/// @return Number of real solutions
 /// @note Code copied from https://cplusplus.com/forum/beginner/234717/
-const std::vector<float> planning::trajectory::Spline5::solveQubicEquation(float a, float b, float c, float d)
+size_t planning::trajectory::Spline5::solveQubicEquation(float a, float b, float c, float d, std::array<float, 3> &roots)
 {
     // 1. option: Using Eigen
     // std::chrono::steady_clock::time_point time_start_ { std::chrono::steady_clock::now() };
@@ -344,7 +496,7 @@ const std::vector<float> planning::trajectory::Spline5::solveQubicEquation(float
 
     // 2. option: Without using Eigen
     // std::chrono::steady_clock::time_point time_start_ { std::chrono::steady_clock::now() };
-    std::vector<float> roots {};
+    size_t num { 0 };
 
     // Reduced equation: X^3 - 3pX - 2q = 0, where X = x-b/(3a)
     float p = (b * b - 3.0 * a * c) / (9.0 * a * a);
@@ -361,23 +513,24 @@ const std::vector<float> planning::trajectory::Spline5::solveQubicEquation(float
         float r = 2.0 * sqrt(p);
         for (size_t n = 0; n < 3; n++)
         {
-            roots.emplace_back(r * cos((theta + 2.0 * n * M_PI) / 3.0) - offset);
+            roots[num++] = r * cos((theta + 2.0 * n * M_PI) / 3.0) - offset;
             // std::cout << roots[n] << "\n";
         }
     }
     else 
     {
-        float gamma1 = cbrt(q + sqrt(-discriminant));
-        float gamma2 = cbrt(q - sqrt(-discriminant));
+        // 'gamma1 * gamma2 = p' is used instead of 'gamma2 = cbrt(q - sign(q) * sqrt(-discriminant))' to avoid cancellation
+        float gamma1 = cbrt(q + std::copysign(sqrt(-discriminant), q));
+        float gamma2 = (gamma1 != 0) ? p / gamma1 : 0;
 
-        roots.emplace_back(gamma1 + gamma2 - offset);
+        roots[num++] = gamma1 + gamma2 - offset;
         // std::cout << roots[0] << "\n";
 
         float re = -0.5 * (gamma1 + gamma2) - offset;
         // float im = (gamma1 - gamma2) * static_cast<float>(sqrt(3.0) / 2.0);
         if (abs(discriminant) < 1e-16)                // Equal roots
         {
-            roots.emplace_back(re);
+            roots[num++] = re;
             // std::cout << re << "\n";
             // std::cout << re << "\n";
         }
@@ -390,5 +543,103 @@ const std::vector<float> planning::trajectory::Spline5::solveQubicEquation(float
     
     // std::cout << "Elapsed time for solving cubic equation: " << 
     //     std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - time_start_).count() << " [ns] \n";
-    return roots;
+    return num;
+}
+
+/// @brief Solve cubic equations a*t³ + b*t² + c*t + d = 0 for all joints at once. 
+/// It is a vectorized version of 'solveQubicEquation', where branches are replaced by selections.
+/// @param roots Only real solutions, while non-existing solutions are set to NaN
+void planning::trajectory::Spline5::solveQubicEquations(const ArrayJ &a_, const ArrayJ &b_, const ArrayJ &c_, const ArrayJ &d_, 
+    std::array<ArrayJ, 3> &roots)
+{
+    const float nan { std::numeric_limits<float>::quiet_NaN() };
+
+    // Reduced equation: X^3 - 3pX - 2q = 0, where X = x-b/(3a)
+    ArrayJ p { (b_ * b_ - 3 * a_ * c_) / (9 * a_ * a_) };
+    ArrayJ q { (9 * a_ * b_ * c_ - 27 * a_ * a_ * d_ - 2 * b_ * b_ * b_) / (54 * a_ * a_ * a_) };
+    ArrayJ offset { b_ / (3 * a_) };
+    ArrayJ discriminant { p * p * p - q * q };
+    ArrayJb all_real { discriminant > 0 };
+
+    // All real roots
+    ArrayJ theta { (q / (p * p.sqrt())).acos() };
+    ArrayJ r { 2 * p.sqrt() };
+
+    // One real root, or equal roots
+    ArrayJ gamma1 { (q + (q < 0).select(-(-discriminant).sqrt(), (-discriminant).sqrt())).unaryExpr([](float x) { return std::cbrt(x); }) };
+    ArrayJ gamma2 { (gamma1 != 0).select(p / gamma1, 0) };
+    ArrayJ re { -0.5 * (gamma1 + gamma2) - offset };
+
+    roots[0] = all_real.select(r * (theta / 3).cos() - offset, gamma1 + gamma2 - offset);
+    roots[1] = all_real.select(r * ((theta + 2 * M_PI) / 3).cos() - offset, (discriminant.abs() < 1e-16).select(re, nan));
+    roots[2] = all_real.select(r * ((theta + 4 * M_PI) / 3).cos() - offset, nan);
+}
+
+/// @brief Compute final times for all joints at once, when the coefficient 'c' is equal to 'c_'.
+/// It is a vectorized version of 'computeFinalTime', which does not change the spline coefficients.
+/// @param c_ Coefficient 'c' for each joint
+/// @param q_final Final configuration
+/// @param t_f Final time for each joint. If it is zero, constraints are not satisfied. If it is infinite, there is no solution.
+/// @param a_ Resulting coefficient 'a' for each joint
+/// @param b_ Resulting coefficient 'b' for each joint
+void planning::trajectory::Spline5::computeFinalTimes(const ArrayJ &c_, const Eigen::VectorXf &q_final, 
+    ArrayJ &t_f, ArrayJ &a_, ArrayJ &b_)
+{
+    assert(num_dimensions <= MAX_NUM_DOFS && "Batch routines support at most 'MAX_NUM_DOFS' joints");
+    std::array<ArrayJ, 3> t_sol {};
+    solveQubicEquations(c_, 3 * d.array(), 6 * e.array(), 10 * (f - q_final).array(), t_sol);
+
+    // The minimal positive solution is taken (NaN is never positive)
+    t_f = ArrayJ::Constant(num_dimensions, INFINITY);
+    for (const ArrayJ &t : t_sol)
+        t_f = (t > 0).select(t.min(t_f), t_f);
+    
+    b_ = -(3 * c_ * t_f * t_f + 3 * d.array() * t_f + 2 * e.array()) / (2 * t_f * t_f * t_f);
+    a_ = -(6 * b_ * t_f * t_f + 3 * c_ * t_f + d.array()) / (10 * t_f * t_f * t_f);
+    t_f = (t_f == INFINITY).select(t_f, checkConstraints(a_, b_, c_, t_f).select(t_f, 0));
+}
+
+/// @brief Check constraints on maximal velocity, acceleration and jerk for all joints at once.
+/// It is a vectorized version of 'checkConstraints(idx, t_f)'.
+/// @return Whether all constraints are satisfied for each joint.
+planning::trajectory::Spline5::ArrayJb planning::trajectory::Spline5::checkConstraints
+    (const ArrayJ &a_, const ArrayJ &b_, const ArrayJ &c_, const ArrayJ &t_f)
+{
+    assert(num_dimensions <= MAX_NUM_DOFS && "Batch routines support at most 'MAX_NUM_DOFS' joints");
+    const float eps { RealVectorSpaceConfig::EQUALITY_THRESHOLD };
+    const auto d_ { d.array() };
+    const auto e_ { e.array() };
+    ArrayJ max_vel(num_dimensions), max_acc(num_dimensions), max_jerk(num_dimensions);
+    for (size_t idx = 0; idx < num_dimensions; idx++)
+    {
+        max_vel(idx) = robot->getMaxVel(idx);
+        max_acc(idx) = robot->getMaxAcc(idx);
+        max_jerk(idx) = robot->getMaxJerk(idx);
+    }
+
+    // Velocity, acceleration and jerk at time 't', which are zero when 't' is not in [0, t_f] (or it is NaN)
+    auto velocity = [&](const ArrayJ &t) -> ArrayJ 
+        { return (t >= 0 && t <= t_f).select(e_ + 2*d_*t + 3*c_*t*t + 4*b_*t*t*t + 5*a_*t*t*t*t, 0); };
+    auto acceleration = [&](const ArrayJ &t) -> ArrayJ 
+        { return (t >= 0 && t <= t_f).select(2*d_ + 6*c_*t + 12*b_*t*t + 20*a_*t*t*t, 0); };
+    auto jerk = [&](const ArrayJ &t) -> ArrayJ 
+        { return (t >= 0 && t <= t_f).select(6*c_ + 24*b_*t + 60*a_*t*t, 0); };
+
+    // Maximal jerk constraint
+    ArrayJb satisfied { !(a_ != 0 && (6 * c_.abs() > max_jerk + eps || jerk(t_f).abs() > max_jerk + eps || 
+                                      jerk(-b_ / (5 * a_)).abs() > max_jerk)) };
+
+    // Maximal acceleration constraint
+    ArrayJ D { 576 * b_ * b_ - 1440 * a_ * c_ };
+    ArrayJb has_acc_max { a_ != 0 && D >= 0 };
+    for (int sign : {-1, 1})
+        satisfied = satisfied && !(has_acc_max && acceleration((-24 * b_ + sign * D.max(0).sqrt()) / (120 * a_)).abs() > max_acc);
+    
+    // Maximal velocity constraint
+    std::array<ArrayJ, 3> t_max {};
+    solveQubicEquations(20 * a_, 12 * b_, 6 * c_, 2 * d_, t_max);
+    for (const ArrayJ &t : t_max)
+        satisfied = satisfied && !(velocity(t).abs() > max_vel);
+
+    return satisfied;
 }
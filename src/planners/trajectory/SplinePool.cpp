@@ -0,0 +1,88 @@
+//
+// Created by agent on 19.10.26.
+//
+
+#include "SplinePool.h"
+
+planning::trajectory::SplinePool::SplinePool(const std::shared_ptr<robots::AbstractRobot> robot_, 
+    const std::shared_ptr<planning::trajectory::BrakingTable> braking_table_, size_t capacity)
+{
+    robot = robot_;
+    braking_table = braking_table_;
+    num_allocations = 0;
+    splines5.reserve(capacity);
+    composite_splines.reserve(capacity);
+    splines4.reserve(capacity);
+
+    const Eigen::VectorXf zero { Eigen::VectorXf::Zero(robot->getNumDOFs()) };
+    for (size_t i = 0; i < capacity; i++)
+    {
+        splines5.emplace_back(std::make_shared<planning::trajectory::Spline5>(robot, zero, zero, zero));
+        composite_splines.emplace_back(std::make_shared<planning::trajectory::CompositeSpline>(robot, zero, zero, zero));
+        splines4.emplace_back(std::make_shared<planning::trajectory::Spline4>(robot, zero, zero, zero, braking_table));
+    }
+}
+
+// Get a quintic spline which starts from the given robot's state
+std::shared_ptr<planning::trajectory::Spline5> planning::trajectory::SplinePool::acquireSpline5
+    (const Eigen::VectorXf &q_current, const Eigen::VectorXf &q_current_dot, const Eigen::VectorXf &q_current_ddot)
+{
+    std::shared_ptr<planning::trajectory::Spline5> spline { getFreeSpline(splines5) };
+    if (spline == nullptr)
+    {
+        spline = std::make_shared<planning::trajectory::Spline5>(robot, q_current, q_current_dot, q_current_ddot);
+        splines5.emplace_back(spline);
+        num_allocations++;
+    }
+    else
+        spline->reset(q_current, q_current_dot, q_current_ddot);
+
+    return spline;
+}
+
+// Get a composite spline which starts from the given robot's state
+std::shared_ptr<planning::trajectory::CompositeSpline> planning::trajectory::SplinePool::acquireCompositeSpline
+    (const Eigen::VectorXf &q_current, const Eigen::VectorXf &q_current_dot, const Eigen::VectorXf &q_current_ddot)
+{
+    std::shared_ptr<planning::trajectory::CompositeSpline> spline { getFreeSpline(composite_splines) };
+    if (spline == nullptr)
+    {
+        spline = std::make_shared<planning::trajectory::CompositeSpline>(robot, q_current, q_current_dot, q_current_ddot);
+        composite_splines.emplace_back(spline);
+        num_allocations++;
+    }
+    else
+        spline->reset(q_current, q_current_dot, q_current_ddot);
+
+    return spline;
+}
+
+// Get an emergency stop which starts from the given robot's state
+std::shared_ptr<planning::trajectory::Spline4> planning::trajectory::SplinePool::acquireSpline4
+    (const Eigen::VectorXf &q_current, const Eigen::VectorXf &q_current_dot, const Eigen::VectorXf &q_current_ddot)
+{
+    std::shared_ptr<planning::trajectory::Spline4> spline { getFreeSpline(splines4) };
+    if (spline == nullptr)
+    {
+        spline = std::make_shared<planning::trajectory::Spline4>(robot, q_current, q_current_dot, q_current_ddot, braking_table);
+        splines4.emplace_back(spline);
+        num_allocations++;
+    }
+    else
+        spline->reset(q_current, q_current_dot, q_current_ddot);
+
+    return spline;
+}
+
+// Find a spline in 'splines' which is not used outside the pool, or return nullptr if all splines are used
+template <class T>
+std::shared_ptr<T> planning::trajectory::SplinePool::getFreeSpline(const std::vector<std::shared_ptr<T>> &splines) const
+{
+    for (const std::shared_ptr<T> &spline : splines)
+    {
+        if (spline.use_count() == 1)
+            return spline;
+    }
+
+    return nullptr;
+}
@@ -71,6 +71,7 @@ robots::Planar2DOF::Planar2DOF(const std::string &robot_desc, size_t num_DOFs_)
 
 void robots::Planar2DOF::setState(const std::shared_ptr<base::State> q)
 {
+	setConfiguration(q);
 	std::shared_ptr<std::vector<KDL::Frame>> frames_fk { computeForwardKinematics(q) };
 	KDL::Frame tf {};
 	for (size_t i = 0; i < links.size(); i++)
@@ -87,10 +88,9 @@ void robots::Planar2DOF::setState(const std::shared_ptr<base::State> q)
 
 std::shared_ptr<std::vector<KDL::Frame>> robots::Planar2DOF::computeForwardKinematics(const std::shared_ptr<base::State> q)
 {
-	setConfiguration(q);
+	// Robot members are only read here, so FK can be computed concurrently from multiple threads
 	KDL::TreeFkSolverPos_recursive tree_fk_solver(robot_tree);
 	std::vector<KDL::Frame> frames_fk(num_DOFs);
-	robot_tree.getChain("base_link", "tool", robot_chain);
 	KDL::JntArray joint_pos { KDL::JntArray(num_DOFs) };
 
 	for (size_t i = 0; i < num_DOFs; i++)
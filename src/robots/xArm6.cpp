@@ -89,6 +89,7 @@ robots::xArm6::xArm6(const std::string &robot_desc, float gripper_length_, bool
 
 void robots::xArm6::setState(const std::shared_ptr<base::State> q)
 {
+	setConfiguration(q);
 	std::shared_ptr<std::vector<KDL::Frame>> frames_fk { computeForwardKinematics(q) };
 	KDL::Frame tf {};
 	for (size_t i = 0; i < links.size(); i++)
@@ -109,10 +110,9 @@ void robots::xArm6::setState(const std::shared_ptr<base::State> q)
 
 std::shared_ptr<std::vector<KDL::Frame>> robots::xArm6::computeForwardKinematics(const std::shared_ptr<base::State> q)
 {
-	setConfiguration(q);
+	// Robot members are only read here, so FK can be computed concurrently from multiple threads
 	KDL::TreeFkSolverPos_recursive tree_fk_solver(robot_tree);
 	std::vector<KDL::Frame> frames_fk(num_DOFs);
-	robot_tree.getChain("link_base", "link_eef", robot_chain);
 	KDL::JntArray joint_pos { KDL::JntArray(num_DOFs) };
 
 	for (size_t i = 0; i < num_DOFs; i++)
@@ -0,0 +1,171 @@
+//
+// Created by agent on 19.10.26.
+//
+
+#include "ConcurrentTree.h"
+
+#include <thread>
+#include <stdexcept>
+
+// Immutable set of states with its own Kd-tree (if it is large enough)
+class base::ConcurrentTree::Block
+{
+public:
+	Block(std::vector<std::shared_ptr<base::State>> &&states_);
+
+	void getNearestState(const Eigen::VectorXf &coord, std::shared_ptr<base::State> &q_near, float &dist_sqr_min) const;
+	
+	template <class BBOX> 
+	bool kdtree_get_bbox(BBOX& /* bb */) const { return false; }
+	inline size_t kdtree_get_point_count() const { return states.size(); }
+	inline float kdtree_get_pt(const size_t idx, const size_t dim) const { return states[idx]->getCoord(dim); }
+
+	std::vector<std::shared_ptr<base::State>> states;
+
+private:
+	typedef nanoflann::KDTreeSingleIndexAdaptor
+		<nanoflann::L2_Simple_Adaptor<float, base::ConcurrentTree::Block>, base::ConcurrentTree::Block /* dim */> KdTree;
+	std::unique_ptr<KdTree> kd_tree;
+};
+
+base::ConcurrentTree::Block::Block(std::vector<std::shared_ptr<base::State>> &&states_)
+{
+	states = std::move(states_);
+	if (states.size() >= MIN_KD_TREE_SIZE)
+	{
+		kd_tree = std::make_unique<KdTree>(states.front()->getNumDimensions(), *this, nanoflann::KDTreeSingleIndexAdaptorParams(10));
+		kd_tree->buildIndex();
+	}
+}
+
+// Update 'q_near' and 'dist_sqr_min' if some state from the block is closer to 'coord'
+void base::ConcurrentTree::Block::getNearestState(const Eigen::VectorXf &coord, std::shared_ptr<base::State> &q_near, 
+												   float &dist_sqr_min) const
+{
+	if (kd_tree != nullptr)
+	{
+		size_t idx { 0 };
+		float dist_sqr { INFINITY };
+		nanoflann::KNNResultSet<float> result_set(1);
+		result_set.init(&idx, &dist_sqr);
+		kd_tree->findNeighbors(result_set, coord.data(), nanoflann::SearchParams(10));
+		if (result_set.size() > 0 && dist_sqr < dist_sqr_min)
+		{
+			q_near = states[idx];
+			dist_sqr_min = dist_sqr;
+		}
+		return;
+	}
+
+	for (const std::shared_ptr<base::State> &q : states)
+	{
+		float dist_sqr { (q->getCoord() - coord).squaredNorm() };
+		if (dist_sqr < dist_sqr_min)
+		{
+			q_near = q;
+			dist_sqr_min = dist_sqr;
+		}
+	}
+}
+
+// 'num_threads_' - number of threads that insert states, where each of them uses its own 'thread_idx' in 'upgradeTree'
+base::ConcurrentTree::ConcurrentTree(const std::string &tree_name_, size_t tree_idx_, size_t num_threads_) :
+	chunks(MAX_NUM_CHUNKS),
+	indexes(std::max(num_threads_, size_t(1)))
+{
+	tree_name = tree_name_;
+	tree_idx = tree_idx_;
+	num_threads = indexes.size();
+	num_reserved = 0;
+	num_states = 0;
+	for (Index &index : indexes)
+		index.blocks.store(std::make_shared<const Blocks>());
+}
+
+base::ConcurrentTree::~ConcurrentTree()
+{
+	for (std::atomic<Chunk*> &chunk : chunks)
+		delete chunk.load();
+}
+
+std::shared_ptr<base::State> base::ConcurrentTree::getState(size_t idx) const
+{
+	if (idx >= getNumStates())
+		throw std::out_of_range("State index is out of range of the concurrent tree! ");
+
+	return (*chunks[idx / CHUNK_SIZE].load(std::memory_order_acquire))[idx % CHUNK_SIZE];
+}
+
+// Get the nearest state to 'q' among all states published so far (nullptr if the tree is empty)
+std::shared_ptr<base::State> base::ConcurrentTree::getNearestState(const std::shared_ptr<base::State> q) const
+{
+	std::shared_ptr<base::State> q_near { nullptr };
+	float dist_sqr_min { INFINITY };
+
+	for (const Index &index : indexes)
+	{
+		std::shared_ptr<const Blocks> blocks { index.blocks.load(std::memory_order_acquire) };
+		for (const std::shared_ptr<const Block> &block : *blocks)
+			block->getNearestState(q->getCoord(), q_near, dist_sqr_min);
+	}
+
+	return q_near;
+}
+
+// 'q_new' - new state added to tree
+// 'q_parent' - parent of 'q_new'
+// 'thread_idx' - index of the calling thread, which must not be used by other threads at the same time
+void base::ConcurrentTree::upgradeTree(const std::shared_ptr<base::State> q_new, const std::shared_ptr<base::State> q_parent, 
+									   size_t thread_idx)
+{
+	// The capacity is checked before a place is reserved, since a reserved place must be published, 
+	// otherwise all subsequent insertions would wait for it forever
+	size_t idx { num_reserved.load(std::memory_order_relaxed) };
+	do
+	{
+		if (idx >= CHUNK_SIZE * MAX_NUM_CHUNKS)
+			throw std::runtime_error("Capacity of the concurrent tree is exceeded! ");
+	}
+	while (!num_reserved.compare_exchange_weak(idx, idx + 1, std::memory_order_relaxed));
+
+	q_new->setTreeIdx(tree_idx);
+	q_new->setIdx(idx);
+	q_new->setParent(q_parent);
+	(*getChunk(idx / CHUNK_SIZE))[idx % CHUNK_SIZE] = q_new;
+
+	// States are published in the order of their indices. Preceding insertions are only a few instructions ahead, so they are awaited
+	size_t num_published { idx };
+	while (!num_states.compare_exchange_weak(num_published, idx + 1, std::memory_order_release, std::memory_order_relaxed))
+	{
+		num_published = idx;
+		std::this_thread::yield();
+	}
+
+	// As in a binary counter, blocks of the same size are merged, and the new list of blocks is published.
+	// Only the owner thread modifies its list, so the old one is still valid for concurrent queries.
+	Index &index { indexes[thread_idx] };
+	std::shared_ptr<Blocks> blocks { std::make_shared<Blocks>(*index.blocks.load(std::memory_order_relaxed)) };
+	std::vector<std::shared_ptr<base::State>> states { q_new };
+	while (!blocks->empty() && blocks->back()->states.size() == states.size())
+	{
+		states.insert(states.end(), blocks->back()->states.begin(), blocks->back()->states.end());
+		blocks->pop_back();
+	}
+	blocks->emplace_back(std::make_shared<const Block>(std::move(states)));
+	index.blocks.store(std::move(blocks), std::memory_order_release);
+}
+
+// Get the chunk with index 'chunk_idx', which is allocated by the first thread that needs it
+base::ConcurrentTree::Chunk *base::ConcurrentTree::getChunk(size_t chunk_idx)
+{
+	Chunk *chunk { chunks[chunk_idx].load(std::memory_order_acquire) };
+	if (chunk != nullptr)
+		return chunk;
+
+	Chunk *chunk_new { new Chunk() };
+	if (chunks[chunk_idx].compare_exchange_strong(chunk, chunk_new, std::memory_order_acq_rel, std::memory_order_acquire))
+		return chunk_new;
+
+	delete chunk_new;		// Another thread has already allocated it
+	return chunk;
+}
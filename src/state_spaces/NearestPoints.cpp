@@ -0,0 +1,12 @@
+//
+// Created by agent on 19.10.26.
+//
+
+#include "NearestPoints.h"
+
+base::NearestPoints::NearestPoints(size_t num_obstacles_, size_t num_links_)
+{
+	num_obstacles = num_obstacles_;
+	num_links = num_links_;
+	points = Eigen::Matrix<float, 6, Eigen::Dynamic>(6, num_obstacles * num_links);
+}
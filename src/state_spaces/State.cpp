@@ -4,6 +4,7 @@
 //
 
 #include "State.h"
+#include <algorithm>
 
 base::State::State(const Eigen::VectorXf &coord_)
 {
@@ -11,12 +12,16 @@ base::State::State(const Eigen::VectorXf &coord_)
 	num_dimensions = coord.size();
 	tree_idx = 0;
 	idx = 0;
+	child_idx = 0;
 	d_c = -1;
 	d_c_profile = std::vector<float>();
 	is_real_d_c = true;
+	d_c_predicted = -1;
+	env_version = 0;
 	cost = -1;
 	nearest_points = nullptr;
-	parent = nullptr;
+	d_c_obstacles = nullptr;
+	parent.reset();
 	children = std::make_shared<std::vector<std::shared_ptr<base::State>>>();
 }
 
@@ -24,9 +29,29 @@ base::State::~State() {}
 
 void base::State::addChild(const std::shared_ptr<base::State> child)
 {
+	child->setChildIdx(children->size());
 	children->emplace_back(child);
 }
 
+// Remove 'child' (compared by identity) from the list of children in O(1) by swapping it with the last child
+void base::State::removeChild(const std::shared_ptr<base::State> child)
+{
+	size_t k { child->getChildIdx() };
+	if (k >= children->size() || children->at(k) != child)	// 'child_idx' is outdated, e.g., 'child' is a copy of some state
+	{
+		k = std::find(children->begin(), children->end(), child) - children->begin();
+		if (k == children->size())
+			return;
+	}
+
+	if (k + 1 < children->size())
+	{
+		children->at(k) = children->back();
+		children->at(k)->setChildIdx(k);
+	}
+	children->pop_back();
+}
+
 namespace base 
 {
 	std::ostream &operator<<(std::ostream &os, const std::shared_ptr<base::State> state)
@@ -9,13 +9,13 @@ base::Tree::Tree(const std::string &tree_name_, size_t tree_idx_)
 	tree_name = tree_name_;
 	tree_idx = tree_idx_;
 	states = std::make_shared<std::vector<std::shared_ptr<base::State>>>();
-	kd_tree = nullptr;
+	nearest_neighbours = nullptr;
 }
 
 base::Tree::Tree(const std::shared_ptr<std::vector<std::shared_ptr<base::State>>> states_)
 {
 	states = states_;
-	kd_tree = nullptr;
+	nearest_neighbours = nullptr;
 }
 
 base::Tree::~Tree()
@@ -23,59 +23,62 @@ base::Tree::~Tree()
 	clearTree();
 }
 
+// Children lists are cleared first, so that states are released one by one instead of recursively,
+// and a root which outlives the tree (e.g., a goal state reused in each replanning) does not keep its subtree alive
 void base::Tree::clearTree()
 {
+	for (const std::shared_ptr<base::State> &state : *states)
+		state->getChildren()->clear();
+	
 	states->clear();
 }
 
-std::shared_ptr<base::State> base::Tree::getNearestState(const std::shared_ptr<base::State> q)
+// Remove all states for which 'is_pruned' holds, together with their descendants. The root is never removed.
+// The remaining states are re-indexed in breadth-first order, and the nearest-neighbour index is rebuilt
+// Return the number of removed states
+size_t base::Tree::pruneTree(const std::function<bool(const std::shared_ptr<base::State>)> &is_pruned)
 {
-	const size_t num_results { 1 };
-	size_t q_near_idx { 0 };
-	float out_dist_sqr { 0 };
-	nanoflann::KNNResultSet<float> result_set(num_results);
-	result_set.init(&q_near_idx, &out_dist_sqr);
-
-	Eigen::VectorXf v { q->getCoord() };
-	std::vector<float> vec(&v[0], v.data()+v.cols()*v.rows());
-
-	float *vec_c = &vec[0];
-	kd_tree->findNeighbors(result_set, vec_c, nanoflann::SearchParams(10));
-	vec_c = nullptr;
-	return getState(q_near_idx);
-}
+	if (states->empty())
+		return 0;
 
-// Get nearest state without using nanoflann library
-std::shared_ptr<base::State> base::Tree::getNearestState2(const std::shared_ptr<base::State> q)
-{
-	size_t q_near_idx { 0 };
-	float d { 0 }, d_min { INFINITY };
-	bool is_out { false };
-	Eigen::VectorXf q_temp {};
+	size_t num_states { states->size() };
+	std::shared_ptr<base::State> q_root { states->front() };
+	std::vector<std::shared_ptr<base::State>> children {};
+	std::vector<std::shared_ptr<base::State>> states_removed {};
+	states->clear();
+	if (nearest_neighbours != nullptr)
+		nearest_neighbours = base::NearestNeighbours::create(nearest_neighbours->getType(), *this, nearest_neighbours->getNumDimensions());
+	
+	upgradeTree(q_root, nullptr);
 
-	for (size_t i = 0; i < states->size(); i++)
+	for (size_t k = 0; k < states->size(); k++)		// 'states' is also used as a queue
 	{
-		q_temp = getState(i)->getCoord();
-		is_out = false;
-		for (size_t k = 0; k < q->getNumDimensions(); k++)
-		{
-			if (abs(q_temp(k) - q->getCoord(k)) > d_min)	// Is outside the box?
-			{
-				is_out = true;
-				break;
-			}
-		}
-		if (!is_out)	// Is inside the box?
+		children = *states->at(k)->getChildren();
+		states->at(k)->getChildren()->clear();
+		for (const std::shared_ptr<base::State> &child : children)
 		{
-			d = (q_temp - q->getCoord()).norm();
-			if (d < d_min)
-			{
-				q_near_idx = i;
-				d_min = d;
-			}
+			if (is_pruned(child))
+				states_removed.emplace_back(child);
+			else
+				upgradeTree(child, states->at(k));
 		}
 	}
-	return getState(q_near_idx);
+
+	// Removed subtrees are released iteratively, as in 'clearTree'
+	for (size_t k = 0; k < states_removed.size(); k++)
+	{
+		for (const std::shared_ptr<base::State> &child : *states_removed[k]->getChildren())
+			states_removed.emplace_back(child);
+		
+		states_removed[k]->getChildren()->clear();
+	}
+
+	return num_states - states->size();
+}
+
+std::shared_ptr<base::State> base::Tree::getNearestState(const std::shared_ptr<base::State> q)
+{
+	return getState(nearest_neighbours->getNearestIdx(q->getCoord()));
 }
 
 // 'q_new' - new state added to tree
@@ -84,7 +87,9 @@ void base::Tree::upgradeTree(const std::shared_ptr<base::State> q_new, const std
 {
 	size_t N { states->size() };
 	states->emplace_back(q_new);
-	kd_tree->addPoints(N, N); 	// Comment this line if you are not using Kd-Trees
+	if (nearest_neighbours != nullptr)
+		nearest_neighbours->add(N);
+	
 	q_new->setTreeIdx(getTreeIdx());
 	q_new->setIdx(N);
 	q_new->setParent(q_parent);
@@ -102,7 +107,9 @@ void base::Tree::upgradeTree(const std::shared_ptr<base::State> q_new, const std
 	q_new->setDistance(q_ref->getDistance());
 	q_new->setDistanceProfile(q_ref->getDistanceProfile());
 	q_new->setIsRealDistance(q_ref->getIsRealDistance());
+	q_new->setEnvVersion(q_ref->getEnvVersion());
 	q_new->setNearestPoints(q_ref->getNearestPoints());
+	q_new->setDistanceObstacles(q_ref->getDistanceObstacles());
 }
 
 namespace base 
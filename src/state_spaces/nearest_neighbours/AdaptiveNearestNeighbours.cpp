@@ -0,0 +1,42 @@
+//
+// Created by agent on 19.10.26.
+//
+
+#include "AdaptiveNearestNeighbours.h"
+#include "KdTreeNearestNeighbours.h"
+
+#include <limits>
+
+base::AdaptiveNearestNeighbours::AdaptiveNearestNeighbours(const base::Tree &tree_, size_t num_dimensions_) : 
+	NearestNeighbours(tree_, num_dimensions_)
+{
+	type = base::NearestNeighboursType::Adaptive;
+	min_index_size = computeMinIndexSize(num_dimensions);
+	nearest_neighbours = base::NearestNeighbours::create(base::NearestNeighboursType::BruteForce, tree, num_dimensions);
+}
+
+void base::AdaptiveNearestNeighbours::add(size_t idx)
+{
+	nearest_neighbours->add(idx);
+	if (idx + 1 == min_index_size && nearest_neighbours->getType() == base::NearestNeighboursType::BruteForce)
+	{
+		nearest_neighbours = std::make_shared<base::KdTreeNearestNeighbours>(tree, num_dimensions);
+		for (size_t k = 0; k <= idx; k++)
+			nearest_neighbours->add(k);
+	}
+}
+
+size_t base::AdaptiveNearestNeighbours::getNearestIdx(const Eigen::VectorXf &coord)
+{
+	return nearest_neighbours->getNearestIdx(coord);
+}
+
+// Number of states from which an index is used instead of brute force. In 'test_nearest_neighbours', brute force was faster than GNAT 
+// in 6-D and 10-D for all tree sizes up to 100000 states, so GNAT is not used. 'MIN_KD_TREE_SIZE' is not a measured crossover.
+size_t base::AdaptiveNearestNeighbours::computeMinIndexSize(size_t num_dimensions_)
+{
+	if (num_dimensions_ <= MAX_KD_TREE_DIMENSIONS)
+		return MIN_KD_TREE_SIZE;
+	
+	return std::numeric_limits<size_t>::max();
+}
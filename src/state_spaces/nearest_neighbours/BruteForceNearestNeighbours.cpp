@@ -0,0 +1,125 @@
+//
+// Created by agent on 19.10.26.
+//
+
+#include "BruteForceNearestNeighbours.h"
+#include "Tree.h"
+
+#include <array>
+
+#if defined(__x86_64__) || defined(__i386__)
+	#include <immintrin.h>
+	#define RPMPL_X86
+#endif
+
+base::BruteForceNearestNeighbours::BruteForceNearestNeighbours(const base::Tree &tree_, size_t num_dimensions_) : 
+	NearestNeighbours(tree_, num_dimensions_)
+{
+	type = base::NearestNeighboursType::BruteForce;
+	num_states = 0;
+}
+
+void base::BruteForceNearestNeighbours::add(size_t idx)
+{
+	const size_t lane { num_states % BLOCK_SIZE };
+	if (lane == 0)		// Unused places of the new block are at infinite distance
+		coords.resize(coords.size() + num_dimensions * BLOCK_SIZE, INFINITY);
+	
+	float *block { &coords[(num_states / BLOCK_SIZE) * num_dimensions * BLOCK_SIZE] };
+	const Eigen::VectorXf &coord { tree.getState(idx)->getCoord() };
+	for (size_t k = 0; k < num_dimensions; k++)
+		block[k * BLOCK_SIZE + lane] = coord(k);
+
+	num_states++;
+}
+
+size_t base::BruteForceNearestNeighbours::getNearestIdx(const Eigen::VectorXf &coord)
+{
+#ifdef RPMPL_X86
+	static const bool is_avx2_supported { __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") };
+	if (is_avx2_supported)
+		return getNearestIdxAVX2(coord);
+#endif
+
+	return getNearestIdxScalar(coord);
+}
+
+// Portable version, whose inner loop over the block is usually vectorized by the compiler
+size_t base::BruteForceNearestNeighbours::getNearestIdxScalar(const Eigen::VectorXf &coord) const
+{
+	size_t idx_min { 0 };
+	float dist_min { INFINITY };
+	std::array<float, BLOCK_SIZE> dist {};
+
+	for (size_t b = 0; b * BLOCK_SIZE < num_states; b++)
+	{
+		const float *block { &coords[b * num_dimensions * BLOCK_SIZE] };
+		dist.fill(0);
+		for (size_t k = 0; k < num_dimensions; k++)
+		{
+			for (size_t lane = 0; lane < BLOCK_SIZE; lane++)
+			{
+				float diff { block[k * BLOCK_SIZE + lane] - coord(k) };
+				dist[lane] += diff * diff;
+			}
+		}
+
+		for (size_t lane = 0; lane < BLOCK_SIZE; lane++)
+		{
+			if (dist[lane] < dist_min)
+			{
+				idx_min = b * BLOCK_SIZE + lane;
+				dist_min = dist[lane];
+			}
+		}
+	}
+
+	return idx_min;
+}
+
+#ifdef RPMPL_X86
+// Each lane keeps its own minimal distance and the corresponding index, which are reduced only at the end
+__attribute__((target("avx2,fma")))
+size_t base::BruteForceNearestNeighbours::getNearestIdxAVX2(const Eigen::VectorXf &coord) const
+{
+	__m256 dist_min { _mm256_set1_ps(INFINITY) };
+	__m256i idx_min { _mm256_setzero_si256() };
+	__m256i idx { _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7) };
+	const __m256i idx_step { _mm256_set1_epi32(BLOCK_SIZE) };
+
+	for (size_t b = 0; b * BLOCK_SIZE < num_states; b++)
+	{
+		const float *block { &coords[b * num_dimensions * BLOCK_SIZE] };
+		__m256 dist { _mm256_setzero_ps() };
+		for (size_t k = 0; k < num_dimensions; k++)
+		{
+			__m256 diff { _mm256_sub_ps(_mm256_loadu_ps(block + k * BLOCK_SIZE), _mm256_set1_ps(coord(k))) };
+			dist = _mm256_fmadd_ps(diff, diff, dist);
+		}
+
+		__m256 is_closer { _mm256_cmp_ps(dist, dist_min, _CMP_LT_OQ) };
+		dist_min = _mm256_blendv_ps(dist_min, dist, is_closer);
+		idx_min = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(idx_min), _mm256_castsi256_ps(idx), is_closer));
+		idx = _mm256_add_epi32(idx, idx_step);
+	}
+
+	alignas(32) std::array<float, BLOCK_SIZE> dist_lanes {};
+	alignas(32) std::array<int32_t, BLOCK_SIZE> idx_lanes {};
+	_mm256_store_ps(dist_lanes.data(), dist_min);
+	_mm256_store_si256(reinterpret_cast<__m256i*>(idx_lanes.data()), idx_min);
+
+	size_t lane_min { 0 };
+	for (size_t lane = 1; lane < BLOCK_SIZE; lane++)
+	{
+		if (dist_lanes[lane] < dist_lanes[lane_min])
+			lane_min = lane;
+	}
+
+	return idx_lanes[lane_min];
+}
+#else
+size_t base::BruteForceNearestNeighbours::getNearestIdxAVX2(const Eigen::VectorXf &coord) const
+{
+	return getNearestIdxScalar(coord);
+}
+#endif
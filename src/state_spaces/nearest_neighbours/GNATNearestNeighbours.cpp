@@ -0,0 +1,151 @@
+//
+// Created by agent on 19.10.26.
+//
+
+#include "GNATNearestNeighbours.h"
+#include "Tree.h"
+
+#include <numeric>
+#include <algorithm>
+
+base::GNATNearestNeighbours::GNATNearestNeighbours(const base::Tree &tree_, size_t num_dimensions_) : 
+	NearestNeighbours(tree_, num_dimensions_)
+{
+	type = base::NearestNeighboursType::GNAT;
+	root = std::make_unique<Node>();
+}
+
+void base::GNATNearestNeighbours::add(size_t idx)
+{
+	insert(root.get(), idx);
+}
+
+size_t base::GNATNearestNeighbours::getNearestIdx(const Eigen::VectorXf &coord)
+{
+	size_t idx_nearest { 0 };
+	float dist_nearest { INFINITY };
+	search(root.get(), coord, idx_nearest, dist_nearest);
+	return idx_nearest;
+}
+
+float base::GNATNearestNeighbours::getDistance(size_t idx, const Eigen::VectorXf &coord) const
+{
+	return (tree.getState(idx)->getCoord() - coord).norm();
+}
+
+// Descend from 'node' to the leaf with the nearest pivots, while updating the distance ranges along the way
+void base::GNATNearestNeighbours::insert(Node *node, size_t idx)
+{
+	const Eigen::VectorXf &coord { tree.getState(idx)->getCoord() };
+	std::vector<float> dist {};
+
+	while (!node->children.empty())
+	{
+		const size_t num_children { node->children.size() };
+		dist.resize(num_children);
+		for (size_t i = 0; i < num_children; i++)
+			dist[i] = getDistance(node->children[i]->pivot, coord);
+		
+		size_t j { size_t(std::min_element(dist.begin(), dist.end()) - dist.begin()) };
+		for (size_t i = 0; i < num_children; i++)
+		{
+			node->dist_min[i * num_children + j] = std::min(node->dist_min[i * num_children + j], dist[i]);
+			node->dist_max[i * num_children + j] = std::max(node->dist_max[i * num_children + j], dist[i]);
+		}
+		node = node->children[j].get();
+	}
+
+	node->states.emplace_back(idx);
+	if (node->states.size() > MAX_LEAF_SIZE)
+		split(node);
+}
+
+// Pivots are chosen among the states of the leaf 'node' by the farthest-point heuristic, and each state is moved to the child 
+// with the nearest pivot. Each pivot belongs to its own child, so no child contains more than 'MAX_LEAF_SIZE' states.
+void base::GNATNearestNeighbours::split(Node *node)
+{
+	std::vector<size_t> pivots { node->states.front() };
+	std::vector<float> dist_pivots(node->states.size(), INFINITY);		// Distance from each state to its nearest pivot
+	while (pivots.size() < DEGREE)
+	{
+		const Eigen::VectorXf &coord_pivot { tree.getState(pivots.back())->getCoord() };
+		size_t k_max { 0 };
+		for (size_t k = 0; k < node->states.size(); k++)
+		{
+			dist_pivots[k] = std::min(dist_pivots[k], getDistance(node->states[k], coord_pivot));
+			if (dist_pivots[k] > dist_pivots[k_max])
+				k_max = k;
+		}
+
+		if (dist_pivots[k_max] == 0)	// All remaining states coincide with pivots
+			break;
+		
+		pivots.emplace_back(node->states[k_max]);
+	}
+
+	if (pivots.size() < 2)		// All states coincide, so the leaf cannot be split
+		return;
+
+	const size_t num_children { pivots.size() };
+	node->dist_min.assign(num_children * num_children, INFINITY);
+	node->dist_max.assign(num_children * num_children, 0);
+	for (size_t pivot : pivots)
+	{
+		node->children.emplace_back(std::make_unique<Node>());
+		node->children.back()->pivot = pivot;
+	}
+
+	std::vector<size_t> states { std::move(node->states) };
+	node->states.clear();
+	for (size_t idx : states)
+		insert(node, idx);
+}
+
+// Update 'idx_nearest' and 'dist_nearest' if some state from the subtree of 'node' is closer to 'coord'
+void base::GNATNearestNeighbours::search(const Node *node, const Eigen::VectorXf &coord, size_t &idx_nearest, float &dist_nearest) const
+{
+	if (node->children.empty())
+	{
+		for (size_t idx : node->states)
+		{
+			float dist { getDistance(idx, coord) };
+			if (dist < dist_nearest)
+			{
+				idx_nearest = idx;
+				dist_nearest = dist;
+			}
+		}
+		return;
+	}
+
+	const size_t num_children { node->children.size() };
+	std::vector<float> dist(num_children);
+	for (size_t i = 0; i < num_children; i++)
+	{
+		dist[i] = getDistance(node->children[i]->pivot, coord);
+		if (dist[i] < dist_nearest)
+		{
+			idx_nearest = node->children[i]->pivot;
+			dist_nearest = dist[i];
+		}
+	}
+
+	// Children are visited from the one with the nearest pivot, so that the remaining ones are pruned more often
+	std::vector<size_t> order(num_children);
+	std::iota(order.begin(), order.end(), 0);
+	std::sort(order.begin(), order.end(), [&dist](size_t a, size_t b) { return dist[a] < dist[b]; });
+
+	for (size_t j : order)
+	{
+		bool is_pruned { false };
+		for (size_t i = 0; i < num_children && !is_pruned; i++)
+		{
+			if (dist[i] - dist_nearest > node->dist_max[i * num_children + j] || 
+				dist[i] + dist_nearest < node->dist_min[i * num_children + j])
+				is_pruned = true;
+		}
+
+		if (!is_pruned)
+			search(node->children[j].get(), coord, idx_nearest, dist_nearest);
+	}
+}
@@ -0,0 +1,27 @@
+//
+// Created by agent on 19.10.26.
+//
+
+#include "KdTreeNearestNeighbours.h"
+
+base::KdTreeNearestNeighbours::KdTreeNearestNeighbours(const base::Tree &tree_, size_t num_dimensions_) : 
+	NearestNeighbours(tree_, num_dimensions_)
+{
+	type = base::NearestNeighboursType::KdTree;
+	kd_tree = std::make_shared<base::KdTree>(num_dimensions, tree, nanoflann::KDTreeSingleIndexAdaptorParams(MAX_LEAF_SIZE));
+}
+
+void base::KdTreeNearestNeighbours::add(size_t idx)
+{
+	kd_tree->addPoints(idx, idx);
+}
+
+size_t base::KdTreeNearestNeighbours::getNearestIdx(const Eigen::VectorXf &coord)
+{
+	size_t idx { 0 };
+	float dist_sqr { 0 };
+	nanoflann::KNNResultSet<float> result_set(1);
+	result_set.init(&idx, &dist_sqr);
+	kd_tree->findNeighbors(result_set, coord.data(), nanoflann::SearchParams(10));
+	return idx;
+}
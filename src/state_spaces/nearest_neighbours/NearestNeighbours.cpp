@@ -0,0 +1,33 @@
+//
+// Created by agent on 19.10.26.
+//
+
+#include "NearestNeighbours.h"
+#include "BruteForceNearestNeighbours.h"
+#include "KdTreeNearestNeighbours.h"
+#include "GNATNearestNeighbours.h"
+#include "AdaptiveNearestNeighbours.h"
+
+base::NearestNeighbours::NearestNeighbours(const base::Tree &tree_, size_t num_dimensions_) : tree(tree_)
+{
+	num_dimensions = num_dimensions_;
+}
+
+base::NearestNeighbours::~NearestNeighbours() {}
+
+// Create an index of type 'type_'. Only 'Adaptive' index uses brute force while 'tree_' is small
+std::shared_ptr<base::NearestNeighbours> base::NearestNeighbours::create(base::NearestNeighboursType type_, const base::Tree &tree_, 
+																		 size_t num_dimensions_)
+{
+	switch (type_)
+	{
+		case base::NearestNeighboursType::BruteForce:
+			return std::make_shared<base::BruteForceNearestNeighbours>(tree_, num_dimensions_);
+		case base::NearestNeighboursType::KdTree:
+			return std::make_shared<base::KdTreeNearestNeighbours>(tree_, num_dimensions_);
+		case base::NearestNeighboursType::GNAT:
+			return std::make_shared<base::GNATNearestNeighbours>(tree_, num_dimensions_);
+		default:
+			return std::make_shared<base::AdaptiveNearestNeighbours>(tree_, num_dimensions_);
+	}
+}
@@ -0,0 +1,32 @@
+//
+// Created by agent on 19.10.26.
+//
+
+#include "NearestNeighboursType.h"
+
+namespace base
+{
+	std::ostream &operator<<(std::ostream &os, const base::NearestNeighboursType &type) 
+	{
+		switch (type)
+		{
+			case base::NearestNeighboursType::KdTree:
+				os << "KdTree";
+				break;
+
+			case base::NearestNeighboursType::GNAT:
+				os << "GNAT";
+				break;
+
+			case base::NearestNeighboursType::BruteForce:
+				os << "BruteForce";
+				break;
+
+			case base::NearestNeighboursType::Adaptive:
+				os << "Adaptive";
+				break;
+		}
+
+		return os;
+	}
+}
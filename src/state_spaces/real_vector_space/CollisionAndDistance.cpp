@@ -3,7 +3,7 @@
 #include <tuple>
 
 // Check collision between capsule (determined with line segment AB and 'radius') and box (determined with 'obs = (x_min, y_min, z_min, x_max, y_max, z_max)')
-bool base::CollisionAndDistance::collisionCapsuleToBox(const Eigen::Vector3f &A, const Eigen::Vector3f &B, float radius, Eigen::VectorXf &obs)
+bool base::CollisionAndDistance::collisionCapsuleToBox(const Eigen::Vector3f &A, const Eigen::Vector3f &B, float radius, const Eigen::VectorXf &obs)
 {
     bool collision { false };
     float r_new = radius * sqrt(3) / 3;
@@ -46,7 +46,7 @@ bool base::CollisionAndDistance::collisionCapsuleToBox(const Eigen::Vector3f &A,
 // Check collision between capsule (determined with line segment AB and 'radius') and rectangle (determined with 'obs',
 // where 'coord' determines which coordinate is constant: {0,1,2,3,4,5} = {x_min, y_min, z_min, x_max, y_max, z_max}
 bool base::CollisionAndDistance::collisionCapsuleToRectangle(const Eigen::Vector3f &A, const Eigen::Vector3f &B, float radius, 
-															 Eigen::VectorXf &obs, size_t coord)
+															 const Eigen::VectorXf &obs, size_t coord)
 {
 	float obs_coord { obs(coord) };
     if (coord > 2) {
@@ -181,7 +181,7 @@ bool base::CollisionAndDistance::collisionLineSegToLineSeg(const Eigen::Vector3f
 }
 
 // Check collision between capsule (determined with line segment AB and 'radius') and sphere (determined with 'obs = (x_c, y_c, z_c, r)')
-bool base::CollisionAndDistance::collisionCapsuleToSphere(const Eigen::Vector3f &A, const Eigen::Vector3f &B, float radius, Eigen::VectorXf &obs)
+bool base::CollisionAndDistance::collisionCapsuleToSphere(const Eigen::Vector3f &A, const Eigen::Vector3f &B, float radius, const Eigen::VectorXf &obs)
 {
 	radius += obs(3);
     if ((A - obs.head(3)).norm() < radius || (B - obs.head(3)).norm() < radius)
@@ -208,7 +208,7 @@ bool base::CollisionAndDistance::collisionCapsuleToSphere(const Eigen::Vector3f
 // Get distance (and nearest points) between capsule (determined with line segment AB and 'radius') 
 // and box (determined with 'obs = (x_min, y_min, z_min, x_max, y_max, z_max)')
 std::tuple<float, std::shared_ptr<Eigen::MatrixXf>> base::CollisionAndDistance::distanceCapsuleToBox
-	(const Eigen::Vector3f &A, const Eigen::Vector3f &B, float radius, Eigen::VectorXf &obs)
+	(const Eigen::Vector3f &A, const Eigen::Vector3f &B, float radius, const Eigen::VectorXf &obs)
 {
 	CapsuleToBox capsule_box(A, B, radius, obs);
 	capsule_box.compute();
@@ -346,7 +346,7 @@ std::tuple<float, std::shared_ptr<Eigen::MatrixXf>> base::CollisionAndDistance::
 // Get distance (and nearest points) between capsule (determined with line segment AB and 'radius') 
 // and sphere (determined with 'obs = (x_c, y_c, z_c, r)')
 std::tuple<float, std::shared_ptr<Eigen::MatrixXf>> base::CollisionAndDistance::distanceCapsuleToSphere
-	(const Eigen::Vector3f &A, const Eigen::Vector3f &B, float radius, Eigen::VectorXf &obs)
+	(const Eigen::Vector3f &A, const Eigen::Vector3f &B, float radius, const Eigen::VectorXf &obs)
 {
     std::shared_ptr<Eigen::MatrixXf> nearest_pts { std::make_shared<Eigen::MatrixXf>(3, 2) };
 	float AO { (A - obs.head(3)).norm() };
@@ -394,7 +394,7 @@ std::tuple<float, std::shared_ptr<Eigen::MatrixXf>> base::CollisionAndDistance::
 }
 
 // ------------------------------------------------ Class CapsuleToBox -------------------------------------------------------//
-base::CollisionAndDistance::CapsuleToBox::CapsuleToBox(const Eigen::Vector3f &A_, const Eigen::Vector3f &B_, float radius_, Eigen::VectorXf &obs_)
+base::CollisionAndDistance::CapsuleToBox::CapsuleToBox(const Eigen::Vector3f &A_, const Eigen::Vector3f &B_, float radius_, const Eigen::VectorXf &obs_)
 {
 	A = A_;
 	B = B_;
@@ -207,32 +207,56 @@ bool base::RealVectorSpace::isValid(const std::shared_ptr<base::State> q1, const
 }
 
 bool base::RealVectorSpace::isValid(const std::shared_ptr<base::State> q)
+{
+	return isValid(q, env->getObstacleTable(), nullptr);
+}
+
+// Check the validity of 'q' when dynamic obstacles are at their predicted positions after 't' seconds from now
+// The environment is not changed, and the obstacle table is not copied
+bool base::RealVectorSpace::isValidAt(const std::shared_ptr<base::State> q, float t)
+{
+	thread_local Eigen::Matrix3Xf displacements {};		// Reused by all predictions in the same thread
+	env->predictDisplacements(t, displacements);
+
+	return isValid(q, env->getObstacleTable(), &displacements);
+}
+
+// Check the validity of 'q' regarding the given 'obstacles'
+// If 'displacements' is not nullptr, j-th obstacle is considered to be displaced by its j-th column, 
+// which is equivalent to displacing the robot's links by the opposite vector
+bool base::RealVectorSpace::isValid(const std::shared_ptr<base::State> q, const std::vector<env::ObstacleDescriptor> &obstacles,
+	const Eigen::Matrix3Xf *displacements)
 {
 	std::shared_ptr<Eigen::MatrixXf> skeleton { robot->computeSkeleton(q) };
+	Eigen::Vector3f A {}, B {};		// Endpoints of the link relative to the obstacle
 	
 	for (size_t i = 0; i < robot->getNumLinks(); i++)
 	{
-    	for (size_t j = 0; j < env->getNumObjects(); j++)
+    	for (size_t j = 0; j < obstacles.size(); j++)
 		{
-			if ((env->getObject(j)->getLabel() == "table" && (i == 0 || i == 1)) && 
-				robot->getType().find("with_table") != std::string::npos)
+			const env::ObstacleDescriptor &obs { obstacles[j] };
+			if ((obs.ignored_links >> i) & 1)
 				continue;
-            else if (env->getCollObject(j)->getNodeType() == fcl::NODE_TYPE::GEOM_BOX)
+
+			A = skeleton->col(i);
+			B = skeleton->col(i+1);
+			if (displacements != nullptr)
+			{
+				A -= displacements->col(j);
+				B -= displacements->col(j);
+			}
+
+            if (obs.type == fcl::NODE_TYPE::GEOM_BOX)
 			{
-				// std::cout << "(i,j) = (" <<i<<","<<j<<")" << std::endl;
 				// std::cout << "r(i): " << robot->getCapsuleRadius(i) << std::endl;
 				// std::cout << "skeleton(i):   " << skeleton->col(i).transpose() << std::endl;
 				// std::cout << "skeleton(i+1): " << skeleton->col(i+1).transpose() << std::endl;
-				fcl::AABB AABB { env->getCollObject(j)->getAABB() };
-				Eigen::VectorXf obs(6);
-				obs << AABB.min_[0], AABB.min_[1], AABB.min_[2], AABB.max_[0], AABB.max_[1], AABB.max_[2];
-				if (collisionCapsuleToBox(skeleton->col(i), skeleton->col(i+1), robot->getCapsuleRadius(i), obs))
+				if (collisionCapsuleToBox(A, B, robot->getCapsuleRadius(i), obs.bounds))
 					return false;
             }
-			else if (env->getCollObject(j)->getNodeType() == fcl::NODE_TYPE::GEOM_SPHERE)
+			else if (obs.type == fcl::NODE_TYPE::GEOM_SPHERE)
 			{
-				Eigen::VectorXf obs(4); 	// TODO
-                if (collisionCapsuleToSphere(skeleton->col(i), skeleton->col(i+1), robot->getCapsuleRadius(i), obs))
+                if (collisionCapsuleToSphere(A, B, robot->getCapsuleRadius(i), obs.bounds))
 					return false;
             }
         }
@@ -244,57 +268,74 @@ bool base::RealVectorSpace::isValid(const std::shared_ptr<base::State> q)
 // Return a minimal distance from the robot in configuration 'q' to obstacles
 // Compute a minimal distance from each robot's link in configuration 'q' to obstacles, i.e., compute a distance profile function
 // Moreover, set 'd_c', 'd_c_profile', and corresponding 'nearest_points' for the configuation 'q'
-// If 'compute_again' is true, the new distance profile will be computed again!
+// The distance is reused if it was computed in the current environment version, unless 'compute_again' is true
 float base::RealVectorSpace::computeDistance(const std::shared_ptr<base::State> q, bool compute_again)
 {
-	if (!compute_again && q->getDistance() > 0 && q->getIsRealDistance())
+	if (!compute_again && q->getDistance() >= 0 && q->getIsRealDistance() && q->getEnvVersion() == env->getVersion())
 		return q->getDistance();
 
+	if (!compute_again && q->getDistance() > 0 && q->getIsRealDistance() && q->getDistanceObstacles() != nullptr && 
+		q->getEnvVersion() >= env->getTableVersion())
+		return computeDistanceIncrementally(q);
+
+	float d_c { computeDistance(q, env->getObstacleTable(), nullptr) };
+	q->setEnvVersion(env->getVersion());
+	
+	return d_c;
+}
+
+// Return a minimal distance from the robot in configuration 'q' to obstacles, 
+// when dynamic obstacles are at their predicted positions after 't' seconds from now.
+// The distance is computed for a scratch state, so the real distance of 'q' is not changed, and it is stored as 'd_c_predicted'.
+// The environment is not changed, and the obstacle table is not copied.
+float base::RealVectorSpace::computeDistanceAt(const std::shared_ptr<base::State> q, float t)
+{
+	thread_local Eigen::Matrix3Xf displacements {};					// Reused by all predictions in the same thread
+	thread_local std::shared_ptr<base::State> q_scratch { nullptr };	// Its buffers are reused by the distance computation
+	if (q_scratch == nullptr || q_scratch->getNumDimensions() != num_dimensions)
+		q_scratch = getNewState(q->getCoord());
+	else
+		q_scratch->setCoord(q->getCoord());
+
+	env->predictDisplacements(t, displacements);
+	float d_c { computeDistance(q_scratch, env->getObstacleTable(), &displacements) };
+	q->setDistancePredicted(d_c);
+
+	return d_c;
+}
+
+// Compute a distance profile for the configuration 'q' regarding the given 'obstacles'
+// If 'displacements' is not nullptr, j-th obstacle is considered to be displaced by its j-th column (see 'computeLinkDistance')
+// Buffers of 'q' are overwritten if they are not shared with other states, otherwise new ones are allocated
+float base::RealVectorSpace::computeDistance(const std::shared_ptr<base::State> q, const std::vector<env::ObstacleDescriptor> &obstacles,
+	const Eigen::Matrix3Xf *displacements)
+{
 	float d_c_temp { INFINITY };
 	float d_c { INFINITY };
-	std::vector<float> d_c_profile(robot->getNumLinks(), 0);
-	std::shared_ptr<std::vector<Eigen::MatrixXf>> nearest_points { std::make_shared<std::vector<Eigen::MatrixXf>>
-		(std::vector<Eigen::MatrixXf>(env->getNumObjects(), Eigen::MatrixXf(6, robot->getNumLinks()))) };
-	std::shared_ptr<Eigen::MatrixXf> nearest_pts { std::make_shared<Eigen::MatrixXf>(3, 2) };
+	thread_local std::vector<float> d_c_profile {};		// Reused by all computations in the same thread
+	d_c_profile.assign(robot->getNumLinks(), 0);
+
+	std::shared_ptr<base::NearestPoints> nearest_points { q->getNearestPoints() };
+	if (nearest_points == nullptr || nearest_points.use_count() > 2 || nearest_points->getNumObstacles() != obstacles.size())
+		nearest_points = std::make_shared<base::NearestPoints>(obstacles.size(), robot->getNumLinks());
+
+	std::shared_ptr<Eigen::MatrixXf> d_c_obstacles { q->getDistanceObstacles() };
+	if (d_c_obstacles == nullptr || d_c_obstacles.use_count() > 2)		// One reference is held by 'q', and one here
+		d_c_obstacles = std::make_shared<Eigen::MatrixXf>(robot->getNumLinks() + 1, obstacles.size());
+	else
+		d_c_obstacles->resize(robot->getNumLinks() + 1, obstacles.size());
+	std::shared_ptr<Eigen::MatrixXf> nearest_pts { nullptr };
 	std::shared_ptr<Eigen::MatrixXf> skeleton { robot->computeSkeleton(q) };
 
 	for (size_t i = 0; i < robot->getNumLinks(); i++)
 	{
 		d_c_profile[i] = INFINITY;
-    	for (size_t j = 0; j < env->getNumObjects(); j++)
+    	for (size_t j = 0; j < obstacles.size(); j++)
 		{
-			if ((env->getObject(j)->getLabel() == "table" && (i == 0 || i == 1)) && 
-				robot->getType().find("with_table") != std::string::npos)
-			{
-				d_c_temp = INFINITY;
-				nearest_pts->col(0) << 0, 0, 0; 			// Robot nearest point
-				nearest_pts->col(1) << 0, 0, -INFINITY;		// Obstacle nearest point
-			}
-            else if (env->getCollObject(j)->getNodeType() == fcl::NODE_TYPE::GEOM_BOX)
-			{
-				fcl::AABB AABB { env->getCollObject(j)->getAABB() };
-				Eigen::VectorXf obs(6);
-				obs << AABB.min_[0], AABB.min_[1], AABB.min_[2], AABB.max_[0], AABB.max_[1], AABB.max_[2];
-                tie(d_c_temp, nearest_pts) = distanceCapsuleToBox(skeleton->col(i), skeleton->col(i+1), robot->getCapsuleRadius(i), obs);
-				
-				// std::cout << "(i, j) = (" << i << ", " << j << "). " << std::endl;
-				// std::cout << "Distance:    " << d_c_temp << std::endl;
-				// if (nearest_pts != nullptr)
-				// {
-				// 	std::cout << "Nearest point link:    " << nearest_pts->col(0).transpose() << std::endl;
-				// 	std::cout << "Nearest point obs:     " << nearest_pts->col(1).transpose() << std::endl;
-				// }
-				// std::cout << "r(i): " << robot->getCapsuleRadius(i) << std::endl;
-				// std::cout << "skeleton(i):   " << skeleton->col(i).transpose() << std::endl;
-				// std::cout << "skeleton(i+1): " << skeleton->col(i+1).transpose() << std::endl;
-				// std::cout << "-------------------------------------------------------------" << std::endl;
-            }
-			else if (env->getCollObject(j)->getNodeType() == fcl::NODE_TYPE::GEOM_SPHERE)
-			{
-				Eigen::VectorXf obs(4); 	// TODO
-                tie(d_c_temp, nearest_pts) = distanceCapsuleToSphere(skeleton->col(i), skeleton->col(i+1), robot->getCapsuleRadius(i), obs);
-            }
-
+			if (displacements == nullptr)
+				tie(d_c_temp, nearest_pts) = computeLinkDistance(skeleton, i, obstacles[j]);
+			else
+				tie(d_c_temp, nearest_pts) = computeLinkDistance(skeleton, i, obstacles[j], displacements->col(j));
 			d_c_profile[i] = std::min(d_c_profile[i], d_c_temp);
             if (d_c_profile[i] <= 0)		// The collision occurs
 			{
@@ -302,31 +343,188 @@ float base::RealVectorSpace::computeDistance(const std::shared_ptr<base::State>
 				q->setDistanceProfile(d_c_profile);
 				q->setIsRealDistance(true);
 				q->setNearestPoints(nullptr);
+				q->setDistanceObstacles(nullptr);
 				return 0;
 			}
 			
 			// 'nearest_pts->col(0)' is robot nearest point, and 'nearest_pts->col(1)' is obstacle nearest point
-			nearest_points->at(j).col(i) << nearest_pts->col(0), nearest_pts->col(1);
+			nearest_points->getPoints(j, i) << nearest_pts->col(0), nearest_pts->col(1);
+			d_c_obstacles->coeffRef(i, j) = d_c_temp;
         }
 		d_c = std::min(d_c, d_c_profile[i]);
     }
+	d_c_obstacles->row(robot->getNumLinks()).setConstant(env->getTime());
 
 	q->setDistance(d_c);
 	q->setDistanceProfile(d_c_profile);
 	q->setIsRealDistance(true);
 	q->setNearestPoints(nearest_points);
+	q->setDistanceObstacles(d_c_obstacles);
 	
 	return d_c;
 }
 
+// Refresh the distance-to-obstacles for the configuration 'q', which is computed in some previous environment version.
+// Only the obstacles that have moved since then are considered. Moreover, a moved obstacle is skipped if, 
+// regarding its maximal velocity, it cannot be nearer to any robot's link than the currently nearest obstacle. 
+// Its obstacle nearest points are then moved towards the robot for the maximal travelled distance.
+// Only the entries of moved obstacles are updated, and buffers of 'q' are copied only if they are shared with other states.
+float base::RealVectorSpace::computeDistanceIncrementally(const std::shared_ptr<base::State> q)
+{
+	const size_t num_links { robot->getNumLinks() };
+	const std::vector<env::ObstacleDescriptor> &obstacles { env->getObstacleTable() };
+	std::shared_ptr<Eigen::MatrixXf> d_c_obstacles { q->getDistanceObstacles() };
+	std::shared_ptr<base::NearestPoints> nearest_points { q->getNearestPoints() };
+	thread_local std::vector<float> d_c_profile {};			// Reused by all computations in the same thread
+	thread_local std::vector<size_t> moved_obstacles {};
+	d_c_profile.assign(num_links, INFINITY);
+	moved_obstacles.clear();
+
+	// Distances to obstacles that have not moved are still valid
+	for (size_t j = 0; j < obstacles.size(); j++)
+	{
+		if (obstacles[j].time_updated > d_c_obstacles->coeff(num_links, j))
+			moved_obstacles.emplace_back(j);
+		else
+		{
+			for (size_t i = 0; i < num_links; i++)
+				d_c_profile[i] = std::min(d_c_profile[i], d_c_obstacles->coeff(i, j));
+		}
+	}
+
+	if (!moved_obstacles.empty())
+	{
+		// One reference is held by 'q', and one here
+		if (d_c_obstacles.use_count() > 2)
+			d_c_obstacles = std::make_shared<Eigen::MatrixXf>(*d_c_obstacles);
+		if (nearest_points.use_count() > 2)
+			nearest_points = std::make_shared<base::NearestPoints>(*nearest_points);
+	}
+
+	float d_c_temp { INFINITY };
+	float delta_max { 0 };			// Maximal travelled distance of the obstacle since its distance is computed
+	bool skip { true };
+	Eigen::Vector3f R {};			// Robot's nearest point
+	std::shared_ptr<Eigen::MatrixXf> nearest_pts { nullptr };
+	std::shared_ptr<Eigen::MatrixXf> skeleton { nullptr };
+
+	for (size_t j : moved_obstacles)
+	{
+		delta_max = obstacles[j].max_vel * (env->getTime() - d_c_obstacles->coeff(num_links, j));
+		skip = true;
+		for (size_t i = 0; i < num_links && skip; i++)
+		{
+			if (!((obstacles[j].ignored_links >> i) & 1) && d_c_obstacles->coeff(i, j) - delta_max <= d_c_profile[i])
+				skip = false;
+		}
+
+		if (skip)
+		{
+			for (size_t i = 0; i < num_links; i++)
+			{
+				if ((obstacles[j].ignored_links >> i) & 1)
+					continue;
+				
+				// The new obstacle nearest point is at the distance 'd_c - delta_max' from the robot's link
+				R = nearest_points->getRobotPoint(j, i);
+				nearest_points->getPoints(j, i).tail<3>() = R + (nearest_points->getObstaclePoint(j, i) - R).normalized() * 
+					(d_c_obstacles->coeff(i, j) - delta_max + robot->getCapsuleRadius(i));
+			}
+			continue;
+		}
+
+		if (skeleton == nullptr)
+			skeleton = robot->computeSkeleton(q);
+		
+		for (size_t i = 0; i < num_links; i++)
+		{
+			tie(d_c_temp, nearest_pts) = computeLinkDistance(skeleton, i, obstacles[j]);
+			d_c_profile[i] = std::min(d_c_profile[i], d_c_temp);
+			if (d_c_profile[i] <= 0)		// The collision occurs
+			{
+				q->setDistance(0);
+				q->setDistanceProfile(d_c_profile);
+				q->setIsRealDistance(true);
+				q->setEnvVersion(env->getVersion());
+				q->setNearestPoints(nullptr);
+				q->setDistanceObstacles(nullptr);
+				return 0;
+			}
+
+			nearest_points->getPoints(j, i) << nearest_pts->col(0), nearest_pts->col(1);
+			d_c_obstacles->coeffRef(i, j) = d_c_temp;
+		}
+		d_c_obstacles->coeffRef(num_links, j) = env->getTime();
+	}
+
+	q->setDistance(*std::min_element(d_c_profile.begin(), d_c_profile.end()));
+	q->setDistanceProfile(d_c_profile);
+	q->setIsRealDistance(true);
+	q->setEnvVersion(env->getVersion());
+	q->setNearestPoints(nearest_points);
+	q->setDistanceObstacles(d_c_obstacles);
+
+	return q->getDistance();
+}
+
+// Compute a distance between the 'link_idx'-th robot's link, which is determined by 'skeleton', and the obstacle 'obs'
+// Return the distance and nearest points, where 'nearest_pts->col(0)' is robot nearest point, and 'nearest_pts->col(1)' is obstacle nearest point
+std::tuple<float, std::shared_ptr<Eigen::MatrixXf>> base::RealVectorSpace::computeLinkDistance
+	(const std::shared_ptr<Eigen::MatrixXf> skeleton, size_t link_idx, const env::ObstacleDescriptor &obs)
+{
+	if ((obs.ignored_links >> link_idx) & 1)
+	{
+		std::shared_ptr<Eigen::MatrixXf> nearest_pts { std::make_shared<Eigen::MatrixXf>(3, 2) };
+		nearest_pts->col(0) << 0, 0, 0; 			// Robot nearest point
+		nearest_pts->col(1) << 0, 0, -INFINITY;		// Obstacle nearest point
+		return {INFINITY, nearest_pts};
+	}
+	else if (obs.type == fcl::NODE_TYPE::GEOM_BOX)
+	{
+		// std::cout << "r(i): " << robot->getCapsuleRadius(link_idx) << std::endl;
+		// std::cout << "skeleton(i):   " << skeleton->col(link_idx).transpose() << std::endl;
+		// std::cout << "skeleton(i+1): " << skeleton->col(link_idx+1).transpose() << std::endl;
+		return distanceCapsuleToBox(skeleton->col(link_idx), skeleton->col(link_idx+1), robot->getCapsuleRadius(link_idx), obs.bounds);
+	}
+	else if (obs.type == fcl::NODE_TYPE::GEOM_SPHERE)
+		return distanceCapsuleToSphere(skeleton->col(link_idx), skeleton->col(link_idx+1), robot->getCapsuleRadius(link_idx), obs.bounds);
+
+	return {INFINITY, nullptr};
+}
+
+// Compute a distance between the 'link_idx'-th robot's link and the obstacle 'obs' displaced by 'displacement'
+// The link is displaced by the opposite vector instead, and the nearest points are then moved back by 'displacement'
+std::tuple<float, std::shared_ptr<Eigen::MatrixXf>> base::RealVectorSpace::computeLinkDistance
+	(const std::shared_ptr<Eigen::MatrixXf> skeleton, size_t link_idx, const env::ObstacleDescriptor &obs, 
+	const Eigen::Vector3f &displacement)
+{
+	if ((obs.ignored_links >> link_idx) & 1)
+		return computeLinkDistance(skeleton, link_idx, obs);
+
+	const Eigen::Vector3f A { skeleton->col(link_idx) - displacement };
+	const Eigen::Vector3f B { skeleton->col(link_idx+1) - displacement };
+	float d_c { INFINITY };
+	std::shared_ptr<Eigen::MatrixXf> nearest_pts { nullptr };
+	
+	if (obs.type == fcl::NODE_TYPE::GEOM_BOX)
+		tie(d_c, nearest_pts) = distanceCapsuleToBox(A, B, robot->getCapsuleRadius(link_idx), obs.bounds);
+	else if (obs.type == fcl::NODE_TYPE::GEOM_SPHERE)
+		tie(d_c, nearest_pts) = distanceCapsuleToSphere(A, B, robot->getCapsuleRadius(link_idx), obs.bounds);
+	
+	if (nearest_pts != nullptr)
+		nearest_pts->colwise() += displacement;
+
+	return {d_c, nearest_pts};
+}
+
 // Return an underestimation of distance-to-obstacles 'd_c', i.e. return a distance-to-planes, 
 // Compute an underestimation of distance-to-obstacles 'd_c' for each robot's link, 
 // i.e. compute the distance-to-planes profile function, when robot is in the configuration 'q', 
 // where planes approximate obstacles, and are generated according to 'nearest_points'
 float base::RealVectorSpace::computeDistanceUnderestimation(const std::shared_ptr<base::State> q, 
-	const std::shared_ptr<std::vector<Eigen::MatrixXf>> nearest_points)
+	const std::shared_ptr<base::NearestPoints> nearest_points)
 {
-	if (q->getDistance() > 0 && q->getIsRealDistance()) 	// Real distance was already computed
+	if (q->getDistance() > 0 && q->getIsRealDistance() && q->getEnvVersion() == env->getVersion()) 	// Real distance was already computed
 		return q->getDistance();
 	
 	float d_c_temp { INFINITY };
@@ -341,10 +539,10 @@ float base::RealVectorSpace::computeDistanceUnderestimation(const std::shared_pt
 		d_c_profile[i] = INFINITY;
         for (size_t j = 0; j < env->getNumObjects(); j++)
         {
-            O = nearest_points->at(j).col(i).tail(3);
+            O = nearest_points->getObstaclePoint(j, i);
 			if (O.norm() < INFINITY)
 			{
-				R = nearest_points->at(j).col(i).head(3);
+				R = nearest_points->getRobotPoint(j, i);
 				d_c_temp = std::min(std::abs((R - O).dot(skeleton->col(i) - O)) / (R - O).norm(), 
 									std::abs((R - O).dot(skeleton->col(i+1) - O)) / (R - O).norm()) 
 									- robot->getCapsuleRadius(i);
@@ -359,7 +557,8 @@ float base::RealVectorSpace::computeDistanceUnderestimation(const std::shared_pt
 		d_c = std::min(d_c, d_c_profile[i]);
     }
 
-	if (d_c > q->getDistance())		// Also, if it was previously computed (q->getDistance() > 0), take "better" (greater) one
+	// Also, if it was previously computed (q->getDistance() > 0), take "better" (greater) one, unless it is outdated
+	if (d_c > q->getDistance() || (q->getIsRealDistance() && q->getEnvVersion() != env->getVersion()))
 	{
 		q->setDistance(d_c);
 		q->setDistanceProfile(d_c_profile);
@@ -21,13 +21,13 @@ bool base::RealVectorSpaceFCL::isValid(const std::shared_ptr<base::State> q)
 {
 	robot->setState(q);	
 	fcl::DefaultCollisionData<float> collision_data {};
+	const std::vector<env::ObstacleDescriptor> &obstacles { env->getObstacleTable() };
 
 	for (size_t i = 0; i < robot->getNumLinks(); i++)
 	{	
-		for (size_t j = 0; j < env->getNumObjects(); j++)
+		for (size_t j = 0; j < obstacles.size(); j++)
 		{
-			if ((env->getObject(j)->getLabel() == "table" && (i == 0 || i == 1)) && 
-				robot->getType().find("with_table") != std::string::npos)
+			if ((obstacles[j].ignored_links >> i) & 1)
 				continue;
 			else
 			{
@@ -50,27 +50,26 @@ bool base::RealVectorSpaceFCL::isValid(const std::shared_ptr<base::State> q)
 // Return minimal distance from robot in configuration 'q' to obstacles
 // Compute minimal distance from each robot's link in configuration 'q' to obstacles, i.e., compute distance profile function
 // Moreover, set 'd_c', 'd_c_profile', and corresponding 'nearest_points' for the configuation 'q'
-// If 'compute_again' is true, the new distance profile will be computed again!
+// The distance is reused if it was computed in the current environment version, unless 'compute_again' is true
 float base::RealVectorSpaceFCL::computeDistance(const std::shared_ptr<base::State> q, bool compute_again)
 {
-	if (!compute_again && q->getDistance() > 0 && q->getIsRealDistance())
+	if (!compute_again && q->getDistance() >= 0 && q->getIsRealDistance() && q->getEnvVersion() == env->getVersion())
 		return q->getDistance();
 	
 	float d_c { INFINITY };
 	std::vector<float> d_c_profile(robot->getNumLinks(), 0);
-	std::shared_ptr<std::vector<Eigen::MatrixXf>> nearest_points { std::make_shared<std::vector<Eigen::MatrixXf>>
-		(std::vector<Eigen::MatrixXf>(env->getNumObjects(), Eigen::MatrixXf(6, robot->getNumLinks()))) };
+	std::shared_ptr<base::NearestPoints> nearest_points { std::make_shared<base::NearestPoints>(env->getNumObjects(), robot->getNumLinks()) };
 	std::shared_ptr<Eigen::MatrixXf> nearest_pts { std::make_shared<Eigen::MatrixXf>(3, 2) };
 	fcl::DefaultDistanceData<float> distance_data;
 	robot->setState(q);
+	const std::vector<env::ObstacleDescriptor> &obstacles { env->getObstacleTable() };
 	
 	for (size_t i = 0; i < robot->getNumLinks(); i++)
 	{
 		d_c_profile[i] = INFINITY;
-		for (size_t j = 0; j < env->getNumObjects(); j++)
+		for (size_t j = 0; j < obstacles.size(); j++)
 		{
-			if ((env->getObject(j)->getLabel() == "table" && (i == 0 || i == 1)) && 
-				robot->getType().find("with_table") != std::string::npos)
+			if ((obstacles[j].ignored_links >> i) & 1)
 			{
 				nearest_pts->col(0) << 0, 0, 0; 			// Robot nearest point
 				nearest_pts->col(1) << 0, 0, -INFINITY;		// Obstacle nearest point
@@ -102,12 +101,13 @@ float base::RealVectorSpaceFCL::computeDistance(const std::shared_ptr<base::Stat
 				q->setDistance(0);
 				q->setDistanceProfile(d_c_profile);
 				q->setIsRealDistance(true);
+				q->setEnvVersion(env->getVersion());
 				q->setNearestPoints(nullptr);
 				return 0;
 			}
 			
 			// 'nearest_pts->col(0)' is robot nearest point, and 'nearest_pts->col(1)' is obstacle nearest point
-			nearest_points->at(j).col(i) << nearest_pts->col(0), nearest_pts->col(1);
+			nearest_points->getPoints(j, i) << nearest_pts->col(0), nearest_pts->col(1);
 		}
 		d_c = std::min(d_c, d_c_profile[i]);
 	}
@@ -115,6 +115,7 @@ float base::RealVectorSpaceFCL::computeDistance(const std::shared_ptr<base::Stat
 	q->setDistance(d_c);
 	q->setDistanceProfile(d_c_profile);
 	q->setIsRealDistance(true);
+	q->setEnvVersion(env->getVersion());
 	q->setNearestPoints(nearest_points);
 	
 	return d_c;
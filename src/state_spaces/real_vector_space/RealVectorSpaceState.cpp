@@ -18,11 +18,15 @@ base::RealVectorSpaceState::RealVectorSpaceState(const std::shared_ptr<base::Sta
 	num_dimensions = state->getNumDimensions();
 	tree_idx = state->getTreeIdx();
 	idx = state->getIdx();
+	child_idx = state->getChildIdx();
 	d_c = state->getDistance();
 	d_c_profile = state->getDistanceProfile();
 	is_real_d_c = state->getIsRealDistance();
+	d_c_predicted = state->getDistancePredicted();
+	env_version = state->getEnvVersion();
 	cost = state->getCost();
 	nearest_points = state->getNearestPoints();
+	d_c_obstacles = state->getDistanceObstacles();
 	parent = state->getParent();
 	children = state->getChildren();
 }
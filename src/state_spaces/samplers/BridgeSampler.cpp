@@ -0,0 +1,31 @@
+//
+// Created by agent on 19.10.26.
+//
+
+#include "BridgeSampler.h"
+
+base::BridgeSampler::BridgeSampler(const std::shared_ptr<base::StateSpace> ss_, float std_dev_) : Sampler(ss_)
+{
+	sampler_type = base::SamplerType::Bridge;
+	std_dev = std_dev_;
+}
+
+std::shared_ptr<base::State> base::BridgeSampler::sample()
+{
+	for (size_t num_attempts = 0; num_attempts < MAX_NUM_ATTEMPTS; num_attempts++)
+	{
+		std::shared_ptr<base::State> q1 { ss->getRandomState() };
+		if (ss->isValid(q1))
+			continue;
+
+		std::shared_ptr<base::State> q2 { ss->getNewState(sampleGaussian(q1->getCoord(), std_dev)) };
+		if (ss->isValid(q2))
+			continue;
+
+		std::shared_ptr<base::State> q_mid { ss->getNewState((q1->getCoord() + q2->getCoord()) / 2) };
+		if (ss->isValid(q_mid))
+			return q_mid;
+	}
+
+	return ss->getRandomState();
+}
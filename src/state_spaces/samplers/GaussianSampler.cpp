@@ -0,0 +1,29 @@
+//
+// Created by agent on 19.10.26.
+//
+
+#include "GaussianSampler.h"
+
+base::GaussianSampler::GaussianSampler(const std::shared_ptr<base::StateSpace> ss_, float std_dev_) : Sampler(ss_)
+{
+	sampler_type = base::SamplerType::Gaussian;
+	std_dev = std_dev_;
+}
+
+std::shared_ptr<base::State> base::GaussianSampler::sample()
+{
+	for (size_t num_attempts = 0; num_attempts < MAX_NUM_ATTEMPTS; num_attempts++)
+	{
+		std::shared_ptr<base::State> q1 { ss->getRandomState() };
+		std::shared_ptr<base::State> q2 { ss->getNewState(sampleGaussian(q1->getCoord(), std_dev)) };
+		bool is_valid1 { ss->isValid(q1) };
+		bool is_valid2 { ss->isValid(q2) };
+
+		if (is_valid1 && !is_valid2)
+			return q1;
+		else if (!is_valid1 && is_valid2)
+			return q2;
+	}
+
+	return ss->getRandomState();
+}
@@ -0,0 +1,21 @@
+//
+// Created by agent on 19.10.26.
+//
+
+#include "GoalBiasSampler.h"
+
+base::GoalBiasSampler::GoalBiasSampler(const std::shared_ptr<base::StateSpace> ss_, const std::shared_ptr<base::State> q_goal_, 
+									   float goal_bias_) : Sampler(ss_)
+{
+	sampler_type = base::SamplerType::GoalBias;
+	q_goal = q_goal_;
+	goal_bias = goal_bias_;
+}
+
+std::shared_ptr<base::State> base::GoalBiasSampler::sample()
+{
+	if (std::uniform_real_distribution<float>(0, 1)(generator) < goal_bias)
+		return ss->getNewState(q_goal->getCoord());		// A new state, since the returned state may be added to a tree
+
+	return ss->getRandomState();
+}
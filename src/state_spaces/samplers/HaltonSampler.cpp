@@ -0,0 +1,57 @@
+//
+// Created by agent on 19.10.26.
+//
+
+#include "HaltonSampler.h"
+
+base::HaltonSampler::HaltonSampler(const std::shared_ptr<base::StateSpace> ss_) : Sampler(ss_)
+{
+	sampler_type = base::SamplerType::Halton;
+	idx = 1;
+
+	// The first 'num_dimensions' primes
+	for (size_t n = 2; bases.size() < ss->num_dimensions; n++)
+	{
+		if (std::all_of(bases.begin(), bases.end(), [n](size_t p) { return n % p != 0; }))
+			bases.emplace_back(n);
+	}
+
+	std::uniform_real_distribution<float> distribution(0, 1);
+	shift = Eigen::VectorXf(ss->num_dimensions);
+	for (size_t i = 0; i < ss->num_dimensions; i++)
+		shift(i) = distribution(generator);
+}
+
+std::shared_ptr<base::State> base::HaltonSampler::sample()
+{
+	const std::vector<std::pair<float, float>> &limits { ss->robot->getLimits() };
+	Eigen::VectorXf coord(ss->num_dimensions);
+
+	for (size_t i = 0; i < ss->num_dimensions; i++)
+	{
+		float u { computeRadicalInverse(idx, bases[i]) + shift(i) };
+		if (u >= 1)
+			u -= 1;
+		
+		coord(i) = limits[i].first + u * (limits[i].second - limits[i].first);
+	}
+
+	idx++;
+	return ss->getNewState(coord);
+}
+
+// Van der Corput radical inverse of 'idx' in 'base', i.e., digits of 'idx' mirrored around the decimal point
+float base::HaltonSampler::computeRadicalInverse(size_t idx, size_t base)
+{
+	double result { 0 };
+	double factor { 1.0 / base };
+
+	while (idx > 0)
+	{
+		result += (idx % base) * factor;
+		idx /= base;
+		factor /= base;
+	}
+
+	return result;
+}
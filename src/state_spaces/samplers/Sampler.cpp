@@ -0,0 +1,60 @@
+//
+// Created by agent on 19.10.26.
+//
+
+#include "Sampler.h"
+#include "UniformSampler.h"
+#include "GoalBiasSampler.h"
+#include "GaussianSampler.h"
+#include "BridgeSampler.h"
+#include "HaltonSampler.h"
+#include "RealVectorSpaceConfig.h"
+
+base::Sampler::Sampler(const std::shared_ptr<base::StateSpace> ss_)
+{
+	ss = ss_;
+	generator.seed(std::random_device{}());
+}
+
+base::Sampler::~Sampler() {}
+
+// Create a sampler of type 'sampler_type_', whose parameters are read from the state space configuration.
+// If 'q_goal_' is not passed, goal-biased sampling falls back to uniform sampling.
+std::shared_ptr<base::Sampler> base::Sampler::create(base::SamplerType sampler_type_, const std::shared_ptr<base::StateSpace> ss_,
+													 const std::shared_ptr<base::State> q_goal_)
+{
+	switch (sampler_type_)
+	{
+	case base::SamplerType::GoalBias:
+		if (q_goal_ != nullptr)
+			return std::make_shared<base::GoalBiasSampler>(ss_, q_goal_, RealVectorSpaceConfig::GOAL_BIAS);
+		break;
+
+	case base::SamplerType::Gaussian:
+		return std::make_shared<base::GaussianSampler>(ss_, RealVectorSpaceConfig::SAMPLER_STD_DEV);
+
+	case base::SamplerType::Bridge:
+		return std::make_shared<base::BridgeSampler>(ss_, RealVectorSpaceConfig::SAMPLER_STD_DEV);
+
+	case base::SamplerType::Halton:
+		return std::make_shared<base::HaltonSampler>(ss_);
+
+	default:
+		break;
+	}
+
+	return std::make_shared<base::UniformSampler>(ss_);
+}
+
+// Get a state whose coordinates are normally distributed around 'mean' with 'std_dev', and limited by robot joint limits
+Eigen::VectorXf base::Sampler::sampleGaussian(const Eigen::VectorXf &mean, float std_dev)
+{
+	std::normal_distribution<float> distribution(0, std_dev);
+	const std::vector<std::pair<float, float>> &limits { ss->robot->getLimits() };
+	Eigen::VectorXf coord { mean };
+
+	for (size_t i = 0; i < ss->num_dimensions; i++)
+		coord(i) = std::clamp(coord(i) + distribution(generator), limits[i].first, limits[i].second);
+
+	return coord;
+}
@@ -0,0 +1,36 @@
+//
+// Created by agent on 19.10.26.
+//
+
+#include "SamplerType.h"
+
+namespace base
+{
+	std::ostream &operator<<(std::ostream &os, const base::SamplerType &type) 
+	{
+		switch (type)
+		{
+			case base::SamplerType::Uniform:
+				os << "Uniform";
+				break;
+
+			case base::SamplerType::GoalBias:
+				os << "GoalBias";
+				break;
+
+			case base::SamplerType::Gaussian:
+				os << "Gaussian";
+				break;
+
+			case base::SamplerType::Bridge:
+				os << "Bridge";
+				break;
+
+			case base::SamplerType::Halton:
+				os << "Halton";
+				break;
+		}
+
+		return os;
+	}
+}
@@ -0,0 +1,15 @@
+//
+// Created by agent on 19.10.26.
+//
+
+#include "UniformSampler.h"
+
+base::UniformSampler::UniformSampler(const std::shared_ptr<base::StateSpace> ss_) : Sampler(ss_)
+{
+	sampler_type = base::SamplerType::Uniform;
+}
+
+std::shared_ptr<base::State> base::UniformSampler::sample()
+{
+	return ss->getRandomState();
+}
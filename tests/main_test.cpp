@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 #include "tests_realvectorspacestate.h"
+#include "tests_tree.h"
+#include "tests_planners.h"
+#include "tests_splines.h"
 
 int main(int argc, char **argv) 
 {
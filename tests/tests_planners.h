@@ -0,0 +1,63 @@
+//
+// Created by agent on 19.10.26.
+//
+#include "Scenario.h"
+#include "ConfigurationReader.h"
+#include "RRTConnect.h"
+#include "RBTConnect.h"
+#include "RGBTConnect.h"
+#include <gtest/gtest.h>
+
+
+const std::string getTestsProjectPath()
+{
+    std::string project_path(__FILE__);
+    for (size_t i = 0; i < 2; i++)  // This depends on how deep is this file located
+        project_path = project_path.substr(0, project_path.find_last_of("/\\"));
+
+    return project_path;
+}
+
+// Check that the path found by 'planner' starts at 'q_start', ends at 'q_goal', and that all its edges are valid
+void checkPath(planning::AbstractPlanner &planner, const std::shared_ptr<base::StateSpace> ss,
+    const std::shared_ptr<base::State> q_start, const std::shared_ptr<base::State> q_goal)
+{
+    ASSERT_TRUE(planner.solve());
+    const std::vector<std::shared_ptr<base::State>> &path { planner.getPath() };
+    ASSERT_GE(path.size(), 2);
+    ASSERT_TRUE(ss->isEqual(path.front(), q_start));
+    ASSERT_TRUE(ss->isEqual(path.back(), q_goal));
+    for (size_t i = 1; i < path.size(); i++)
+        ASSERT_TRUE(ss->isValid(path[i-1], path[i]));
+}
+
+class PlannersTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        const std::string project_path { getTestsProjectPath() };
+        ConfigurationReader::initConfiguration(project_path);
+        scenario = std::make_shared<scenario::Scenario>("/data/planar_2dof/scenario_test/scenario_test.yaml", project_path);
+    }
+
+    std::shared_ptr<scenario::Scenario> scenario;
+};
+
+TEST_F(PlannersTest, testRRTConnectPathConnectsStartAndGoal)
+{
+    planning::rrt::RRTConnect planner(scenario->getStateSpace(), scenario->getStart(), scenario->getGoal());
+    checkPath(planner, scenario->getStateSpace(), scenario->getStart(), scenario->getGoal());
+}
+
+TEST_F(PlannersTest, testRBTConnectPathConnectsStartAndGoal)
+{
+    planning::rbt::RBTConnect planner(scenario->getStateSpace(), scenario->getStart(), scenario->getGoal());
+    checkPath(planner, scenario->getStateSpace(), scenario->getStart(), scenario->getGoal());
+}
+
+TEST_F(PlannersTest, testRGBTConnectPathConnectsStartAndGoal)
+{
+    planning::rbt::RGBTConnect planner(scenario->getStateSpace(), scenario->getStart(), scenario->getGoal());
+    checkPath(planner, scenario->getStateSpace(), scenario->getStart(), scenario->getGoal());
+}
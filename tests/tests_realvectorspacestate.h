@@ -22,3 +22,15 @@ TEST(RealVectorSpaceStateTest, testConstructor1)
     ASSERT_EQ(q->getNumDimensions(), 6);
     ASSERT_EQ(q->getCoord(), state_coord);
 }
+
+TEST(RealVectorSpaceStateTest, testCopyConstructor)
+{
+    std::shared_ptr<base::State> q = std::make_shared<base::RealVectorSpaceState>(Eigen::Vector2f({1, 2}));
+    q->setDistance(0.5);
+    q->setEnvVersion(3);
+    std::shared_ptr<base::State> q_copy = std::make_shared<base::RealVectorSpaceState>(q);
+
+    ASSERT_EQ(q_copy->getCoord(), q->getCoord());
+    ASSERT_EQ(q_copy->getDistance(), 0.5);
+    ASSERT_EQ(q_copy->getEnvVersion(), 3);
+}
@@ -0,0 +1,444 @@
+//
+// Created by agent on 19.10.26.
+//
+#include "Planar2DOF.h"
+#include "Spline4.h"
+#include "Spline5.h"
+#include "CompositeSpline.h"
+#include "SplinePool.h"
+#include <gtest/gtest.h>
+#include <random>
+
+
+class SplinesTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        robot = std::make_shared<robots::Planar2DOF>(getTestsProjectPath() + "/data/planar_2dof/planar_2dof.urdf");
+        robot->setMaxVel(std::vector<float>(robot->getNumDOFs(), 3));
+        robot->setMaxAcc(std::vector<float>(robot->getNumDOFs(), 10));
+        robot->setMaxJerk(std::vector<float>(robot->getNumDOFs(), 100));
+    }
+
+    // Random vector whose 'idx'-th entry is uniformly distributed in [-'scale' * 'max[idx]', 'scale' * 'max[idx]']
+    Eigen::VectorXf getRandomVector(float (robots::AbstractRobot::*getMax)(size_t) const, float scale = 1)
+    {
+        std::uniform_real_distribution<float> distribution(-scale, scale);
+        Eigen::VectorXf v(robot->getNumDOFs());
+        for (size_t idx = 0; idx < robot->getNumDOFs(); idx++)
+            v(idx) = distribution(generator) * ((*robot).*getMax)(idx);
+
+        return v;
+    }
+
+    // Check that 'spline' evaluated at all 'times' at once is the same as evaluated at each time separately
+    void checkEvaluate(planning::trajectory::Spline &spline, const Eigen::VectorXf &times)
+    {
+        std::array<Eigen::MatrixXf, 4> out {};
+        for (size_t derivative = 0; derivative < out.size(); derivative++)
+        {
+            spline.evaluate(times, out[derivative], derivative);
+            ASSERT_EQ(out[derivative].rows(), robot->getNumDOFs());
+            ASSERT_EQ(out[derivative].cols(), times.size());
+        }
+
+        for (int k = 0; k < times.size(); k++)
+        {
+            ASSERT_TRUE(out[0].col(k).isApprox(spline.getPosition(times(k)), 1e-4)) << "Time: " << times(k);
+            ASSERT_LT((out[1].col(k) - spline.getVelocity(times(k))).norm(), 1e-3) << "Time: " << times(k);
+            ASSERT_LT((out[2].col(k) - spline.getAcceleration(times(k))).norm(), 1e-2) << "Time: " << times(k);
+            ASSERT_LT((out[3].col(k) - spline.getJerk(times(k))).norm(), 1e-1) << "Time: " << times(k);
+        }
+    }
+
+    std::shared_ptr<robots::AbstractRobot> robot;
+    std::mt19937 generator { 0 };
+};
+
+// Exposes batch routines of 'Spline5', so that they can be compared with the corresponding scalar ones
+class Spline5Batch : public planning::trajectory::Spline5
+{
+public:
+    using Spline5::Spline5;
+    using Spline5::ArrayJ;
+    using Spline5::checkConstraints;
+    using Spline5::computeFinalTime;
+    using Spline5::computeFinalTimes;
+    using Spline5::solveQubicEquation;
+    using Spline5::solveQubicEquations;
+    using Spline5::a;
+    using Spline5::b;
+    using Spline5::c;
+};
+
+TEST_F(SplinesTest, testBrakingTableDistanceIsConservative)
+{
+    planning::trajectory::BrakingTable braking_table(robot);
+    for (size_t num = 0; num < 1000; num++)
+    {
+        Eigen::VectorXf vel { getRandomVector(&robots::AbstractRobot::getMaxVel) };
+        Eigen::VectorXf acc { getRandomVector(&robots::AbstractRobot::getMaxAcc) };
+        for (size_t idx = 0; idx < robot->getNumDOFs(); idx++)
+        {
+            float t_f { planning::trajectory::BrakingTable::computeTime(vel(idx), acc(idx), robot->getMaxAcc(idx), robot->getMaxJerk(idx)) };
+            ASSERT_TRUE(planning::trajectory::BrakingTable::checkConstraints(vel(idx), acc(idx), t_f, robot->getMaxAcc(idx), robot->getMaxJerk(idx)));
+            ASSERT_GE(braking_table.getDistance(idx, vel(idx), acc(idx)),
+                      std::abs(planning::trajectory::BrakingTable::computeDistance(vel(idx), acc(idx), t_f)) - 1e-4);
+        }
+    }
+}
+
+TEST_F(SplinesTest, testSpline4StopsAtTimeFinal)
+{
+    std::shared_ptr<planning::trajectory::BrakingTable> braking_table { std::make_shared<planning::trajectory::BrakingTable>(robot) };
+    for (size_t num = 0; num < 1000; num++)
+    {
+        Eigen::VectorXf q { getRandomVector(&robots::AbstractRobot::getMaxVel) };
+        planning::trajectory::Spline4 spline(robot, q, getRandomVector(&robots::AbstractRobot::getMaxVel, 0.5),
+                                             getRandomVector(&robots::AbstractRobot::getMaxAcc), braking_table);
+        ASSERT_TRUE(spline.compute());
+
+        for (size_t idx = 0; idx < robot->getNumDOFs(); idx++)
+        {
+            ASSERT_TRUE(spline.checkConstraints(idx, spline.getTimeFinal(idx)));
+            ASSERT_NEAR(spline.getVelocity(spline.getTimeFinal(idx), idx), 0, 1e-3);
+            ASSERT_NEAR(spline.getAcceleration(spline.getTimeFinal(idx), idx), 0, 1e-2);
+        }
+
+        Eigen::VectorXf q_final { spline.getPosition(spline.getTimeFinal()) };
+        ASSERT_TRUE(spline.getPosition(spline.getTimeFinal() + 1).isApprox(q_final));
+        ASSERT_TRUE(spline.getVelocity(spline.getTimeFinal() + 1).isZero());
+        ASSERT_TRUE(spline.getAcceleration(spline.getTimeFinal() + 1).isZero());
+        for (size_t idx = 0; idx < robot->getNumDOFs(); idx++)
+            ASSERT_LE(std::abs(q_final(idx) - q(idx)), braking_table->getDistance(idx, spline.getVelocity(0, idx),
+                      spline.getAcceleration(0, idx)) + 1e-4);
+    }
+}
+
+TEST_F(SplinesTest, testSpline4FailsWhenMaxVelocityIsExceeded)
+{
+    Eigen::VectorXf q { Eigen::VectorXf::Zero(robot->getNumDOFs()) };
+    Eigen::VectorXf q_dot(robot->getNumDOFs());
+    Eigen::VectorXf q_ddot(robot->getNumDOFs());
+    for (size_t idx = 0; idx < robot->getNumDOFs(); idx++)
+    {
+        q_dot(idx) = robot->getMaxVel(idx);     // The joint is still accelerating at its maximal velocity
+        q_ddot(idx) = robot->getMaxAcc(idx);
+    }
+
+    planning::trajectory::Spline4 spline(robot, q, q_dot, q_ddot);
+    ASSERT_FALSE(spline.compute());
+    for (size_t idx = 0; idx < robot->getNumDOFs(); idx++)
+        ASSERT_NEAR(spline.getVelocity(spline.getTimeFinal(idx), idx), 0, 1e-3);
+}
+
+TEST_F(SplinesTest, testCompositeSplineViaVelocities)
+{
+    Eigen::VectorXf q_zero { Eigen::VectorXf::Zero(robot->getNumDOFs()) };
+    planning::trajectory::CompositeSpline spline(robot, q_zero, q_zero, q_zero);
+    std::vector<Eigen::VectorXf> waypoints { Eigen::Vector2f(1, 1), Eigen::Vector2f(2, 2), Eigen::Vector2f(3, 1) };
+    ASSERT_TRUE(spline.compute(waypoints));
+    ASSERT_EQ(spline.getNumSubsplines(), waypoints.size());
+
+    // Each joint keeps moving through a waypoint only if it does not change its direction there
+    const std::vector<Eigen::VectorXf> &via_velocities { spline.getViaVelocities() };
+    ASSERT_GT(via_velocities[0](0), 0);
+    ASSERT_GT(via_velocities[0](1), 0);
+    ASSERT_GT(via_velocities[1](0), 0);
+    ASSERT_EQ(via_velocities[1](1), 0);
+    ASSERT_TRUE(via_velocities.back().isZero());
+    for (size_t k = 0; k < waypoints.size(); k++)
+    {
+        for (size_t idx = 0; idx < robot->getNumDOFs(); idx++)
+            ASSERT_LE(std::abs(via_velocities[k](idx)), planning::trajectory::CompositeSpline::VIA_VELOCITY_SCALE * robot->getMaxVel(idx));
+    }
+}
+
+TEST_F(SplinesTest, testCompositeSplineHalvesViaVelocity)
+{
+    // The robot moves fast towards the first waypoint, but the second one is too close to stop at it with the estimated 
+    // via velocity, which is thus reduced, or the second waypoint is discarded
+    Eigen::VectorXf q_zero { Eigen::VectorXf::Zero(robot->getNumDOFs()) };
+    planning::trajectory::CompositeSpline spline(robot, q_zero, q_zero, q_zero);
+    std::vector<Eigen::VectorXf> waypoints { Eigen::Vector2f(2, 2), Eigen::Vector2f(2.02, 2.02) };
+    ASSERT_TRUE(spline.compute(waypoints));
+
+    // Via velocity after the backward pass is 'sqrt(max_acc * |q2 - q1|)', and it is reduced by halving
+    float vel_max { std::sqrt(robot->getMaxAcc(0) * 0.02f) };
+    const Eigen::VectorXf &via_velocity { spline.getViaVelocities().front() };
+    float scale { via_velocity(0) / vel_max };
+    ASSERT_LT(scale, 1);
+    ASSERT_TRUE(scale == 0 || std::abs(std::log2(scale) - std::round(std::log2(scale))) < 1e-3);
+    ASSERT_NEAR(via_velocity(0), via_velocity(1), 1e-6);
+    ASSERT_LT((spline.getPosition(spline.getTimeFinal()) - spline.getWaypoints().back()).norm(), 1e-2);
+}
+
+TEST_F(SplinesTest, testCompositeSplinePassesThroughWaypoints)
+{
+    std::shared_ptr<planning::trajectory::CompositeSpline> spline_previous { nullptr };
+    size_t num_failures { 0 };
+    for (size_t num = 0; num < 100; num++)
+    {
+        Eigen::VectorXf q_current { getRandomVector(&robots::AbstractRobot::getMaxVel, 0.1) };
+        std::vector<Eigen::VectorXf> waypoints { q_current };
+        for (size_t k = 0; k < 4; k++)
+            waypoints.emplace_back(waypoints.back() + getRandomVector(&robots::AbstractRobot::getMaxVel, 0.2));
+        waypoints.erase(waypoints.begin());
+
+        std::shared_ptr<planning::trajectory::CompositeSpline> spline { std::make_shared<planning::trajectory::CompositeSpline>
+            (robot, q_current, getRandomVector(&robots::AbstractRobot::getMaxVel, 0.1), Eigen::VectorXf::Zero(robot->getNumDOFs())) };
+        if (!spline->compute(waypoints, spline_previous))   // The first waypoint cannot be reached from the initial state
+        {
+            num_failures++;
+            continue;
+        }
+
+        ASSERT_EQ(spline->getNumSubsplines(), spline->getWaypoints().size());
+        ASSERT_TRUE(spline->getPosition(0).isApprox(q_current, 1e-4));
+
+        // Each subspline ends at its waypoint with its via velocity, and the spline is continuous at the connecting times.
+        // Note that a subspline which stops at its waypoint reaches it only approximately, since its final time is found by bisection.
+        const std::vector<float> &times_connecting { spline->getTimesConnecting() };
+        for (size_t k = 0; k < spline->getNumSubsplines(); k++)
+        {
+            float t_end { k + 1 < times_connecting.size() ? times_connecting[k+1] : spline->getTimeFinal() };
+            ASSERT_LT((spline->getPosition(t_end) - spline->getWaypoints()[k]).norm(), 1e-2);
+            ASSERT_LT((spline->getVelocity(t_end) - spline->getViaVelocities()[k]).norm(), 1e-2);
+            ASSERT_LT((spline->getPosition(t_end - 1e-5) - spline->getPosition(t_end)).norm(), 1e-4);
+            ASSERT_LT((spline->getVelocity(t_end - 1e-5) - spline->getVelocity(t_end)).norm(), 1e-2);
+        }
+
+        ASSERT_TRUE(spline->getPosition(spline->getTimeFinal() + 1).isApprox(spline->getPosition(spline->getTimeFinal())));
+        ASSERT_TRUE(spline->getVelocity(spline->getTimeFinal() + 1).isZero(1e-4));
+        spline_previous = spline;
+    }
+    ASSERT_LT(num_failures, 10);
+}
+
+TEST_F(SplinesTest, testSpline5BatchSolvesQubicEquations)
+{
+    Spline5Batch spline(robot, Eigen::VectorXf::Zero(robot->getNumDOFs()));
+    std::uniform_real_distribution<float> distribution(-10, 10);
+    const size_t num_joints { planning::trajectory::Spline5::MAX_NUM_DOFS };
+    for (size_t num = 0; num < 100; num++)
+    {
+        std::array<Spline5Batch::ArrayJ, 4> coeffs {};
+        for (Spline5Batch::ArrayJ &coeff : coeffs)
+            coeff = Spline5Batch::ArrayJ::NullaryExpr(num_joints, [&]() { return distribution(generator); });
+        
+        // The leading coefficient is not near zero (as the jerk coefficient in 'computeFinalTimes'), otherwise roots are ill-conditioned
+        coeffs[0] = (coeffs[0] < 0).select(coeffs[0] - 1, coeffs[0] + 1);
+
+        std::array<Spline5Batch::ArrayJ, 3> roots_batch {};
+        spline.solveQubicEquations(coeffs[0], coeffs[1], coeffs[2], coeffs[3], roots_batch);
+        for (size_t idx = 0; idx < num_joints; idx++)
+        {
+            std::array<float, 3> roots {};
+            size_t num_roots { spline.solveQubicEquation(coeffs[0](idx), coeffs[1](idx), coeffs[2](idx), coeffs[3](idx), roots) };
+            for (size_t i = 0; i < 3; i++)
+            {
+                if (i < num_roots)
+                    ASSERT_NEAR(roots_batch[i](idx), roots[i], 1e-4 * std::max(1.f, std::abs(roots[i])));
+                else
+                    ASSERT_TRUE(std::isnan(roots_batch[i](idx)));
+            }
+        }
+    }
+}
+
+TEST_F(SplinesTest, testSpline5BatchComputesFinalTimes)
+{
+    size_t num_mismatches { 0 };
+    for (size_t num = 0; num < 1000; num++)
+    {
+        Spline5Batch spline(robot, getRandomVector(&robots::AbstractRobot::getMaxVel), getRandomVector(&robots::AbstractRobot::getMaxVel, 0.5),
+                            getRandomVector(&robots::AbstractRobot::getMaxAcc, 0.5));
+        Eigen::VectorXf q_final { getRandomVector(&robots::AbstractRobot::getMaxVel) };
+        Spline5Batch::ArrayJ c_batch { getRandomVector(&robots::AbstractRobot::getMaxJerk).array() };   // Minimal or maximal jerk, as in 'compute'
+        for (size_t idx = 0; idx < robot->getNumDOFs(); idx++)
+            c_batch(idx) = std::copysign(robot->getMaxJerk(idx) / 6, c_batch(idx));
+        Spline5Batch::ArrayJ t_f_batch {}, a_batch {}, b_batch {};
+        spline.computeFinalTimes(c_batch, q_final, t_f_batch, a_batch, b_batch);
+
+        for (size_t idx = 0; idx < robot->getNumDOFs(); idx++)
+        {
+            spline.c(idx) = c_batch(idx);
+            float t_f { spline.computeFinalTime(idx, q_final(idx)) };
+            if (t_f == INFINITY || t_f_batch(idx) == INFINITY)
+                ASSERT_EQ(t_f_batch(idx), t_f);
+            else if ((t_f == 0) != (t_f_batch(idx) == 0))     // Constraints are satisfied only up to rounding errors
+                num_mismatches++;
+            else if (t_f > 0)
+            {
+                ASSERT_NEAR(t_f_batch(idx), t_f, 1e-4 * t_f);
+                ASSERT_NEAR(a_batch(idx), spline.a(idx), 1e-3 * std::max(1.f, std::abs(spline.a(idx))));
+                ASSERT_NEAR(b_batch(idx), spline.b(idx), 1e-3 * std::max(1.f, std::abs(spline.b(idx))));
+            }
+        }
+    }
+    ASSERT_LT(num_mismatches, 10);
+}
+
+TEST_F(SplinesTest, testSpline5BatchChecksConstraints)
+{
+    size_t num_satisfied { 0 };
+    size_t num_mismatches { 0 };
+    std::uniform_real_distribution<float> distribution(0.1, 2);
+    for (size_t num = 0; num < 1000; num++)
+    {
+        Spline5Batch spline(robot, Eigen::VectorXf::Zero(robot->getNumDOFs()), getRandomVector(&robots::AbstractRobot::getMaxVel, 0.5),
+                            getRandomVector(&robots::AbstractRobot::getMaxAcc, 0.5));
+        Spline5Batch::ArrayJ a_batch { getRandomVector(&robots::AbstractRobot::getMaxJerk, 0.1).array() };
+        Spline5Batch::ArrayJ b_batch { getRandomVector(&robots::AbstractRobot::getMaxJerk, 0.1).array() };
+        Spline5Batch::ArrayJ c_batch { getRandomVector(&robots::AbstractRobot::getMaxJerk, 0.2).array() };
+        Spline5Batch::ArrayJ t_f_batch { Spline5Batch::ArrayJ::NullaryExpr(robot->getNumDOFs(), [&]() { return distribution(generator); }) };
+        auto satisfied_batch { spline.checkConstraints(a_batch, b_batch, c_batch, t_f_batch) };
+
+        for (size_t idx = 0; idx < robot->getNumDOFs(); idx++)
+        {
+            spline.a(idx) = a_batch(idx);
+            spline.b(idx) = b_batch(idx);
+            spline.c(idx) = c_batch(idx);
+            bool satisfied { spline.checkConstraints(idx, t_f_batch(idx)) };
+            num_satisfied += satisfied;
+            num_mismatches += (satisfied != satisfied_batch(idx));   // Constraints are satisfied only up to rounding errors
+        }
+    }
+    ASSERT_GT(num_satisfied, 100);
+    ASSERT_LT(num_mismatches, 10);
+}
+
+TEST_F(SplinesTest, testSplineEvaluate)
+{
+    std::shared_ptr<planning::trajectory::BrakingTable> braking_table { std::make_shared<planning::trajectory::BrakingTable>(robot) };
+    size_t num_computed { 0 };
+    for (size_t num = 0; num < 100; num++)
+    {
+        std::vector<std::shared_ptr<planning::trajectory::Spline>> splines {};
+        std::shared_ptr<planning::trajectory::Spline5> spline5 { std::make_shared<planning::trajectory::Spline5>
+            (robot, getRandomVector(&robots::AbstractRobot::getMaxVel), getRandomVector(&robots::AbstractRobot::getMaxVel, 0.5), 
+             getRandomVector(&robots::AbstractRobot::getMaxAcc, 0.5)) };
+        if (spline5->compute(getRandomVector(&robots::AbstractRobot::getMaxVel)))     // The final state may not be reachable
+        {
+            splines.emplace_back(spline5);
+            num_computed++;
+        }
+
+        std::shared_ptr<planning::trajectory::Spline4> spline4 { std::make_shared<planning::trajectory::Spline4>
+            (robot, getRandomVector(&robots::AbstractRobot::getMaxVel), getRandomVector(&robots::AbstractRobot::getMaxVel, 0.5), 
+             getRandomVector(&robots::AbstractRobot::getMaxAcc), braking_table) };
+        spline4->compute();
+        splines.emplace_back(spline4);
+
+        // Times before the start, within the spline (including its final time), and after the final time
+        for (const std::shared_ptr<planning::trajectory::Spline> &spline : splines)
+        {
+            float t_f { spline->getTimeFinal() };
+            Eigen::VectorXf times { Eigen::VectorXf::LinSpaced(21, -0.1 * t_f, 1.1 * t_f) };
+            times(times.size() - 1) = t_f;
+            checkEvaluate(*spline, times);
+        }
+
+        // Derivatives of a higher order than the spline order are zero
+        Eigen::MatrixXf out {};
+        spline5->evaluate(Eigen::VectorXf::LinSpaced(5, 0, 1), out, 6);
+        ASSERT_TRUE(out.isZero());
+    }
+    ASSERT_GT(num_computed, 50);
+}
+
+TEST_F(SplinesTest, testCompositeSplineEvaluate)
+{
+    Eigen::VectorXf q_zero { Eigen::VectorXf::Zero(robot->getNumDOFs()) };
+    planning::trajectory::CompositeSpline spline(robot, q_zero, q_zero, q_zero);
+    
+    // Before computing, the spline stays at its start
+    Eigen::MatrixXf out {};
+    spline.evaluate(Eigen::VectorXf::LinSpaced(3, 0, 1), out, 0);
+    ASSERT_TRUE(out.isZero());
+    spline.evaluate(Eigen::VectorXf::LinSpaced(3, 0, 1), out, 1);
+    ASSERT_TRUE(out.isZero());
+
+    std::vector<Eigen::VectorXf> waypoints { Eigen::Vector2f(1, 1), Eigen::Vector2f(2, 2), Eigen::Vector2f(3, 1) };
+    ASSERT_TRUE(spline.compute(waypoints));
+    const std::vector<float> &times_connecting { spline.getTimesConnecting() };
+    ASSERT_EQ(times_connecting.size(), spline.getNumSubsplines());
+
+    // Times just before, at and just after each connecting time, where the evaluation is split between subsplines
+    std::vector<float> times_split {};
+    for (size_t k = 1; k < times_connecting.size(); k++)
+    {
+        for (float delta : {-1e-4f, 0.f, 1e-4f})
+            times_split.emplace_back(times_connecting[k] + delta);
+    }
+    checkEvaluate(spline, Eigen::Map<Eigen::VectorXf>(times_split.data(), times_split.size()));
+
+    // Unordered times from all subsplines
+    Eigen::VectorXf times { Eigen::VectorXf::LinSpaced(50, spline.getTimeFinal(), 0) };
+    std::shuffle(times.begin(), times.end(), generator);
+    checkEvaluate(spline, times);
+
+    // After the final time, the spline stays at its last waypoint
+    times = Eigen::VectorXf::LinSpaced(5, spline.getTimeFinal(), spline.getTimeFinal() + 1);
+    checkEvaluate(spline, times);
+    for (size_t derivative = 0; derivative < 4; derivative++)
+    {
+        spline.evaluate(times.tail(4), out, derivative);
+        for (int k = 0; k < out.cols(); k++)
+        {
+            if (derivative == 0)
+                ASSERT_TRUE(out.col(k).isApprox(spline.getPosition(spline.getTimeFinal())));
+            else
+                ASSERT_TRUE(out.col(k).isZero());
+        }
+    }
+}
+
+TEST_F(SplinesTest, testSplinePoolRecyclesSplines)
+{
+    std::shared_ptr<planning::trajectory::BrakingTable> braking_table { 
+        std::make_shared<planning::trajectory::BrakingTable>(robot) };
+    planning::trajectory::SplinePool spline_pool(robot, braking_table, 2);
+    Eigen::VectorXf q_zero { Eigen::VectorXf::Zero(robot->getNumDOFs()) };
+    std::vector<Eigen::VectorXf> waypoints { Eigen::Vector2f(1, 1), Eigen::Vector2f(2, 2), Eigen::Vector2f(3, 1) };
+
+    // Splines which are still referenced are not recycled
+    std::shared_ptr<planning::trajectory::Spline> spline5_held { spline_pool.acquireSpline5(q_zero, q_zero, q_zero) };
+    ASSERT_TRUE(spline5_held->compute(waypoints.front()));
+    std::shared_ptr<planning::trajectory::CompositeSpline> composite_held { spline_pool.acquireCompositeSpline(q_zero, q_zero, q_zero) };
+    ASSERT_TRUE(composite_held->compute(waypoints));
+
+    for (size_t num = 0; num < 10; num++)
+    {
+        Eigen::VectorXf q { getRandomVector(&robots::AbstractRobot::getMaxVel, 0.1) };
+        Eigen::VectorXf vel { getRandomVector(&robots::AbstractRobot::getMaxVel, 0.5) };
+        Eigen::VectorXf acc { getRandomVector(&robots::AbstractRobot::getMaxAcc, 0.5) };
+        
+        // A recycled spline is the same as a new one
+        std::shared_ptr<planning::trajectory::Spline> spline5 { spline_pool.acquireSpline5(q, vel, acc) };
+        ASSERT_NE(spline5, spline5_held);
+        std::shared_ptr<planning::trajectory::Spline> spline5_new { std::make_shared<planning::trajectory::Spline5>(robot, q, vel, acc) };
+        ASSERT_EQ(spline5->compute(waypoints.front()), spline5_new->compute(waypoints.front()));
+        ASSERT_FLOAT_EQ(spline5->getTimeFinal(), spline5_new->getTimeFinal());
+        ASSERT_TRUE(spline5->getPosition(spline5->getTimeFinal() / 2).isApprox(spline5_new->getPosition(spline5->getTimeFinal() / 2)));
+
+        std::shared_ptr<planning::trajectory::CompositeSpline> composite { spline_pool.acquireCompositeSpline(q, vel, acc) };
+        ASSERT_NE(composite, composite_held);
+        planning::trajectory::CompositeSpline composite_new(robot, q, vel, acc);
+        ASSERT_EQ(composite->compute(waypoints, num % 2 == 0 ? composite_held : nullptr), composite_new.compute(waypoints));
+        ASSERT_EQ(composite->getNumSubsplines(), composite_new.getNumSubsplines());
+        ASSERT_FLOAT_EQ(composite->getTimeFinal(), composite_new.getTimeFinal());
+
+        std::shared_ptr<planning::trajectory::Spline4> spline4 { spline_pool.acquireSpline4(q, vel, acc) };
+        planning::trajectory::Spline4 spline4_new(robot, q, vel, acc, braking_table);
+        ASSERT_EQ(spline4->compute(), spline4_new.compute());
+        ASSERT_FLOAT_EQ(spline4->getTimeFinal(), spline4_new.getTimeFinal());
+        ASSERT_TRUE(spline4->getPosition(INFINITY).isApprox(spline4_new.getPosition(INFINITY)));
+    }
+
+    // The held splines are not changed
+    ASSERT_TRUE(spline5_held->getPosition(INFINITY).isApprox(waypoints.front(), 1e-3));
+    ASSERT_TRUE(composite_held->getPosition(INFINITY).isApprox(waypoints.back(), 1e-3));
+    ASSERT_EQ(spline_pool.getNumAllocations(), 0);
+}
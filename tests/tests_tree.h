@@ -0,0 +1,227 @@
+//
+// Created by agent on 19.10.26.
+//
+#include "Tree.h"
+#include "ConcurrentTree.h"
+#include "BruteForceNearestNeighbours.h"
+#include "AdaptiveNearestNeighbours.h"
+#include "RealVectorSpaceState.h"
+#include <Eigen/Dense>
+#include <thread>
+#include <random>
+
+
+std::shared_ptr<base::Tree> initTree(const std::shared_ptr<base::State> q_root)
+{
+    std::shared_ptr<base::Tree> tree = std::make_shared<base::Tree>("test", 0);
+    tree->setNearestNeighbours(base::NearestNeighbours::create(base::NearestNeighboursType::KdTree, *tree, 2));
+    tree->upgradeTree(q_root, nullptr);
+    return tree;
+}
+
+TEST(TreeTest, testParentIsNonOwning)
+{
+    std::shared_ptr<base::State> q_root = std::make_shared<base::RealVectorSpaceState>(Eigen::Vector2f({0, 0}));
+    std::shared_ptr<base::Tree> tree = initTree(q_root);
+    std::shared_ptr<base::State> q = std::make_shared<base::RealVectorSpaceState>(Eigen::Vector2f({1, 2}));
+    tree->upgradeTree(q, q_root);
+
+    ASSERT_EQ(q->getParent(), q_root);
+    ASSERT_EQ(q_root->getChildren()->size(), 1);
+    ASSERT_EQ(q_root.use_count(), 2);   // Owned by 'tree' and this test, but not by its child
+}
+
+TEST(TreeTest, testStatesAreReleased)
+{
+    std::shared_ptr<base::State> q_root = std::make_shared<base::RealVectorSpaceState>(Eigen::Vector2f({0, 0}));
+    std::vector<std::weak_ptr<base::State>> states {};
+    {
+        std::shared_ptr<base::Tree> tree = initTree(q_root);
+        std::shared_ptr<base::State> q_parent = q_root;
+        for (size_t i = 1; i <= 100000; i++)    // Deep chain, which must not be released recursively
+        {
+            std::shared_ptr<base::State> q = std::make_shared<base::RealVectorSpaceState>(Eigen::Vector2f({float(i), 0}));
+            tree->upgradeTree(q, q_parent);
+            states.emplace_back(q);
+            q_parent = q;
+        }
+    }
+
+    // 'q_root' outlives the tree, but it must not keep the tree states alive
+    ASSERT_EQ(q_root->getChildren()->size(), 0);
+    for (const std::weak_ptr<base::State> &q : states)
+        ASSERT_TRUE(q.expired());
+}
+
+TEST(TreeTest, testRepeatedReplanning)
+{
+    // As in DRGBT, where a new tree rooted in the same goal state is built in each replanning
+    std::shared_ptr<base::State> q_goal = std::make_shared<base::RealVectorSpaceState>(Eigen::Vector2f({0, 0}));
+    std::vector<std::weak_ptr<base::State>> states {};
+    for (size_t iter = 0; iter < 10000; iter++)
+    {
+        std::shared_ptr<base::Tree> tree = initTree(q_goal);
+        for (size_t i = 0; i < 10; i++)
+        {
+            std::shared_ptr<base::State> q = std::make_shared<base::RealVectorSpaceState>(Eigen::Vector2f({float(iter), float(i)}));
+            tree->upgradeTree(q, tree->getState(i / 2));
+            states.emplace_back(q);
+        }
+    }
+
+    ASSERT_EQ(q_goal->getChildren()->size(), 0);
+    ASSERT_EQ(q_goal.use_count(), 1);
+    for (const std::weak_ptr<base::State> &q : states)
+        ASSERT_TRUE(q.expired());
+}
+
+TEST(TreeTest, testRemoveChild)
+{
+    std::shared_ptr<base::State> q_root = std::make_shared<base::RealVectorSpaceState>(Eigen::Vector2f({0, 0}));
+    std::shared_ptr<base::Tree> tree = initTree(q_root);
+    std::vector<std::shared_ptr<base::State>> children {};
+    for (size_t i = 0; i < 4; i++)
+    {
+        children.emplace_back(std::make_shared<base::RealVectorSpaceState>(Eigen::Vector2f({1, 1})));  // Equal coordinates
+        tree->upgradeTree(children.back(), q_root);
+    }
+
+    q_root->removeChild(children[1]);
+    ASSERT_EQ(q_root->getChildren()->size(), 3);
+    ASSERT_TRUE(std::find(q_root->getChildren()->begin(), q_root->getChildren()->end(), children[1]) == q_root->getChildren()->end());
+    
+    q_root->removeChild(children[0]);
+    q_root->removeChild(children[0]);   // Already removed, so nothing happens
+    ASSERT_EQ(q_root->getChildren()->size(), 2);
+    for (size_t k = 0; k < q_root->getChildren()->size(); k++)
+        ASSERT_EQ(q_root->getChildren()->at(k)->getChildIdx(), k);
+}
+
+TEST(TreeTest, testPruneTree)
+{
+    std::shared_ptr<base::State> q_root = std::make_shared<base::RealVectorSpaceState>(Eigen::Vector2f({0, 0}));
+    std::shared_ptr<base::Tree> tree = initTree(q_root);
+    std::weak_ptr<base::State> q_pruned_descendant {};
+    for (size_t i = 0; i < 3; i++)      // Three branches with two states each
+    {
+        std::shared_ptr<base::State> q1 = std::make_shared<base::RealVectorSpaceState>(Eigen::Vector2f({float(i), 1}));
+        std::shared_ptr<base::State> q2 = std::make_shared<base::RealVectorSpaceState>(Eigen::Vector2f({float(i), 2}));
+        tree->upgradeTree(q1, q_root);
+        tree->upgradeTree(q2, q1);
+        if (i == 1)
+            q_pruned_descendant = q2;
+    }
+
+    size_t num_removed = tree->pruneTree([](const std::shared_ptr<base::State> q) { return q->getCoord(0) == 1; });
+
+    ASSERT_EQ(num_removed, 2);      // Pruned state and its descendant
+    ASSERT_EQ(tree->getNumStates(), 5);
+    ASSERT_EQ(q_root->getChildren()->size(), 2);
+    ASSERT_TRUE(q_pruned_descendant.expired());
+    for (size_t k = 0; k < tree->getNumStates(); k++)
+    {
+        ASSERT_EQ(tree->getState(k)->getIdx(), k);
+        ASSERT_NE(tree->getState(k)->getCoord(0), 1);
+    }
+}
+
+TEST(TreeTest, testConcurrentTree)
+{
+    const size_t num_threads = 4, num_states_per_thread = 2000;
+    std::shared_ptr<base::ConcurrentTree> tree = std::make_shared<base::ConcurrentTree>("test", 0, num_threads);
+    tree->upgradeTree(std::make_shared<base::RealVectorSpaceState>(Eigen::Vector2f({0, 0})), nullptr, 0);
+
+    // Each thread inserts states, whose parents are found by nearest-neighbour queries during the insertions of other threads
+    std::vector<std::thread> threads {};
+    for (size_t t = 0; t < num_threads; t++)
+    {
+        threads.emplace_back([&tree, t]()
+        {
+            std::mt19937 generator(t);
+            std::uniform_real_distribution<float> distribution(-10, 10);
+            for (size_t i = 0; i < num_states_per_thread; i++)
+            {
+                std::shared_ptr<base::State> q = std::make_shared<base::RealVectorSpaceState>
+                    (Eigen::Vector2f({distribution(generator), distribution(generator)}));
+                tree->upgradeTree(q, tree->getNearestState(q), t);
+            }
+        });
+    }
+    for (std::thread &thread : threads)
+        thread.join();
+
+    ASSERT_EQ(tree->getNumStates(), num_threads * num_states_per_thread + 1);
+    for (size_t k = 0; k < tree->getNumStates(); k++)
+    {
+        ASSERT_EQ(tree->getState(k)->getIdx(), k);
+        ASSERT_EQ(tree->getState(k)->getParent() == nullptr, k == 0);
+    }
+
+    std::mt19937 generator(num_threads);
+    std::uniform_real_distribution<float> distribution(-10, 10);
+    for (size_t i = 0; i < 100; i++)
+    {
+        std::shared_ptr<base::State> q = std::make_shared<base::RealVectorSpaceState>
+            (Eigen::Vector2f({distribution(generator), distribution(generator)}));
+        float dist_min = INFINITY;
+        for (size_t k = 0; k < tree->getNumStates(); k++)
+            dist_min = std::min(dist_min, (tree->getState(k)->getCoord() - q->getCoord()).norm());
+        
+        ASSERT_FLOAT_EQ((tree->getNearestState(q)->getCoord() - q->getCoord()).norm(), dist_min);
+    }
+}
+
+TEST(TreeTest, testNearestNeighbours)
+{
+    std::mt19937 generator(0);
+    std::uniform_real_distribution<float> distribution(-3, 3);
+    for (base::NearestNeighboursType type : {base::NearestNeighboursType::KdTree, base::NearestNeighboursType::GNAT, 
+                                             base::NearestNeighboursType::BruteForce, base::NearestNeighboursType::Adaptive})
+    {
+        for (size_t num_dimensions : {2, 10})
+        {
+            std::shared_ptr<base::Tree> tree = std::make_shared<base::Tree>("test", 0);
+            tree->setNearestNeighbours(base::NearestNeighbours::create(type, *tree, num_dimensions));
+            for (size_t i = 0; i <= base::AdaptiveNearestNeighbours::MIN_KD_TREE_SIZE; i++)     // Kd-tree of adaptive index is built at the last state
+                tree->upgradeTree(std::make_shared<base::RealVectorSpaceState>(Eigen::VectorXf::NullaryExpr(num_dimensions, 
+                    [&]() { return distribution(generator); })), nullptr);
+            
+            for (size_t i = 0; i < 20; i++)
+            {
+                Eigen::VectorXf coord = Eigen::VectorXf::NullaryExpr(num_dimensions, [&]() { return distribution(generator); });
+                float dist_min = INFINITY;
+                for (size_t k = 0; k < tree->getNumStates(); k++)
+                    dist_min = std::min(dist_min, (tree->getState(k)->getCoord() - coord).norm());
+                
+                std::shared_ptr<base::State> q = std::make_shared<base::RealVectorSpaceState>(coord);
+                ASSERT_FLOAT_EQ((tree->getNearestState(q)->getCoord() - coord).norm(), dist_min) << "Type: " << type;
+            }
+        }
+    }
+}
+
+TEST(TreeTest, testBruteForceKernels)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    if (!__builtin_cpu_supports("avx2") || !__builtin_cpu_supports("fma"))
+        GTEST_SKIP() << "AVX2 is not supported";
+#endif
+
+    std::mt19937 generator(0);
+    std::uniform_real_distribution<float> distribution(-3, 3);
+    const size_t num_dimensions = 7;
+    std::shared_ptr<base::Tree> tree = std::make_shared<base::Tree>("test", 0);
+    base::BruteForceNearestNeighbours brute_force(*tree, num_dimensions);
+    for (size_t i = 0; i < 50; i++)
+    {
+        tree->upgradeTree(std::make_shared<base::RealVectorSpaceState>(Eigen::VectorXf::NullaryExpr(num_dimensions, 
+            [&]() { return distribution(generator); })), nullptr);
+        brute_force.add(i);
+
+        for (size_t j = 0; j < 10; j++)
+        {
+            Eigen::VectorXf coord = Eigen::VectorXf::NullaryExpr(num_dimensions, [&]() { return distribution(generator); });
+            ASSERT_EQ(brute_force.getNearestIdxAVX2(coord), brute_force.getNearestIdxScalar(coord));
+        }
+    }
+}